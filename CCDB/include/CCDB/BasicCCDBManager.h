@@ -21,6 +21,9 @@
 #include <map>
 #include <unordered_map>
 #include <memory>
+#include <future>
+#include <mutex>
+#include <chrono>
 
 // #include <FairLogger.h>
 
@@ -36,6 +39,13 @@ namespace o2::ccdb
 ///
 /// In cases where caching is not needed or just 1 instance of the manager is enough, one case use
 /// a singleton version BasicCCDBManager
+///
+/// The cache can be bounded in number of objects and in memory (estimated from the size of the
+/// downloaded blob), least recently used objects being evicted first. Pointers to evicted objects
+/// become invalid, as after the clearCache call.
+/// Objects expected to be needed soon (e.g. for the next validity interval) can be requested
+/// asynchronously with prefetch<T>(path, timestamp): the query runs in the background and the
+/// object is adopted by the cache at the 1st getForTimeStamp call for a timestamp within its validity.
 
 class CCDBManagerInstance
 {
@@ -44,10 +54,27 @@ class CCDBManagerInstance
     std::string uuid;
     long startvalidity = 0;
     long endvalidity = 0;
-    bool isValid(long ts) { return ts < endvalidity && ts > startvalidity; }
+    size_t size = 0;       // estimated memory size (size of the CCDB blob)
+    size_t lastAccess = 0; // access counter value at the last request, for LRU eviction
+    bool isValid(long ts) const { return ts < endvalidity && ts > startvalidity; }
+  };
+
+  struct PrefetchRequest {
+    long timestamp = 0;                      // timestamp for which the object was requested
+    std::shared_future<CachedObject> result; // object retrieved in the background
   };
 
  public:
+  /// cache usage statistics
+  struct CacheStats {
+    size_t nHits = 0;         // requests served by cached object (w/o download)
+    size_t nMisses = 0;       // requests needing object download
+    size_t nPrefetchHits = 0; // requests served by prefetched object
+    size_t nEvictions = 0;    // objects evicted from the cache due to the limits
+    double fetchTime = 0.;    // total time in ms the caller was blocked by CCDB queries
+    double maxFetchTime = 0.; // longest blocking query in ms
+  };
+
   CCDBManagerInstance(std::string const& path) : mCCDBAccessor{}
   {
     mCCDBAccessor.init(path);
@@ -93,11 +120,54 @@ class CCDBManagerInstance
 
   bool isHostReachable() const { return mCCDBAccessor.isHostReachable(); }
 
+  /// request asynchronously the object for given path and timestamp, it will be used by the following getForTimeStamp
+  /// for the timestamp within its validity interval
+  template <typename T>
+  void prefetch(std::string const& path, long timestamp, std::map<std::string, std::string> metaData = std::map<std::string, std::string>());
+
+  /// check if there is a pending or completed prefetch request for the path
+  bool isPrefetched(std::string const& path) const { return mPrefetched.find(path) != mPrefetched.end(); }
+
   /// clear all entries in the cache
-  void clearCache() { mCache.clear(); }
+  void clearCache();
 
   /// clear particular entry in the cache
-  void clearCache(std::string const& path) { mCache.erase(path); }
+  void clearCache(std::string const& path);
+
+  /// set max number of cached objects (0 = no limit)
+  void setMaxCachedObjects(size_t n)
+  {
+    mMaxCachedObjects = n;
+    evictObjects();
+  }
+
+  /// get max number of cached objects (0 = no limit)
+  size_t getMaxCachedObjects() const { return mMaxCachedObjects; }
+
+  /// set max estimated memory in bytes of cached objects (0 = no limit)
+  void setMaxCacheMemory(size_t sz)
+  {
+    mMaxCacheMemory = sz;
+    evictObjects();
+  }
+
+  /// get max estimated memory in bytes of cached objects (0 = no limit)
+  size_t getMaxCacheMemory() const { return mMaxCacheMemory; }
+
+  /// get number of cached objects
+  size_t getNCachedObjects() const { return mCache.size(); }
+
+  /// get estimated memory in bytes of cached objects
+  size_t getCacheMemory() const { return mCacheMemory; }
+
+  /// get cache usage statistics
+  const CacheStats& getCacheStats() const { return mStats; }
+
+  /// reset cache usage statistics
+  void resetCacheStats() { mStats = CacheStats{}; }
+
+  /// print cache usage statistics
+  void printCacheStats() const;
 
   /// check if caching is enabled
   bool isCachingEnabled() const { return mCachingEnabled; }
@@ -136,17 +206,38 @@ class CCDBManagerInstance
   void resetCreatedNotBefore() { mCreatedNotBefore = 0; }
 
  private:
+  using Clock = std::chrono::steady_clock;
+
+  /// store in the cached object the object and its validity from the CCDB query headers
+  static void fillCachedObject(CachedObject& cached, std::shared_ptr<void>&& obj, std::map<std::string, std::string>& headers);
+  /// use prefetched object for the path if it is valid for the timestamp
+  bool adoptPrefetched(std::string const& path, long timestamp, CachedObject& cached);
+  /// create the API instance for the background queries, if not done yet
+  void initPrefetchAccessor();
+  /// account blocking query time
+  void registerFetchTime(Clock::time_point start);
+  /// evict least recently used objects (except the one with given path) until the limits are respected
+  void evictObjects(std::string const& keep = "");
+
   // we access the CCDB via the CURL based C++ API
   o2::ccdb::CcdbApi mCCDBAccessor;
-  std::unordered_map<std::string, CachedObject> mCache; //! map for {path, CachedObject} associations
-  std::map<std::string, std::string> mMetaData;         // some dummy object needed to talk to CCDB API
-  std::map<std::string, std::string> mHeaders;          // headers to retrieve tags
-  long mTimestamp{o2::ccdb::getCurrentTimestamp()};     // timestamp to be used for query (by default "now")
-  bool mCanDefault = false;                             // whether default is ok --> useful for testing purposes done standalone/isolation
-  bool mCachingEnabled = true;                          // whether caching is enabled
-  bool mCheckObjValidityEnabled = false;                // wether the validity of cached object is checked before proceeding to a CCDB API query
-  long mCreatedNotAfter = 0;                            // upper limit for object creation timestamp (TimeMachine mode) - If-Not-After HTTP header
-  long mCreatedNotBefore = 0;                           // lower limit for object creation timestamp (TimeMachine mode) - If-Not-Before HTTP header
+  std::unique_ptr<o2::ccdb::CcdbApi> mPrefetchAccessor;         //! API instance used by the background queries
+  std::mutex mPrefetchMutex;                                    //! serializes the background queries on mPrefetchAccessor
+  std::unordered_map<std::string, CachedObject> mCache;         //! map for {path, CachedObject} associations
+  std::unordered_map<std::string, PrefetchRequest> mPrefetched; //! pending or completed prefetch requests
+  std::map<std::string, std::string> mMetaData;                 // some dummy object needed to talk to CCDB API
+  std::map<std::string, std::string> mHeaders;                  // headers to retrieve tags
+  long mTimestamp{o2::ccdb::getCurrentTimestamp()};             // timestamp to be used for query (by default "now")
+  bool mCanDefault = false;                                     // whether default is ok --> useful for testing purposes done standalone/isolation
+  bool mCachingEnabled = true;                                  // whether caching is enabled
+  bool mCheckObjValidityEnabled = false;                        // wether the validity of cached object is checked before proceeding to a CCDB API query
+  long mCreatedNotAfter = 0;                                    // upper limit for object creation timestamp (TimeMachine mode) - If-Not-After HTTP header
+  long mCreatedNotBefore = 0;                                   // lower limit for object creation timestamp (TimeMachine mode) - If-Not-Before HTTP header
+  size_t mMaxCachedObjects = 0;                                 // max number of cached objects (0 = no limit)
+  size_t mMaxCacheMemory = 0;                                   // max estimated memory of cached objects (0 = no limit)
+  size_t mCacheMemory = 0;                                      // current estimated memory of cached objects
+  size_t mAccessCounter = 0;                                    // counter of requests, used as LRU clock
+  CacheStats mStats;                                            // cache usage statistics
 };
 
 template <typename T>
@@ -158,21 +249,32 @@ T* CCDBManagerInstance::getForTimeStamp(std::string const& path, long timestamp)
                                                  mCreatedNotBefore ? std::to_string(mCreatedNotBefore) : "");
   }
   auto& cached = mCache[path];
+  cached.lastAccess = ++mAccessCounter;
   if (mCheckObjValidityEnabled && cached.isValid(timestamp)) {
+    mStats.nHits++;
+    return reinterpret_cast<T*>(cached.objPtr.get());
+  }
+  if (adoptPrefetched(path, timestamp, cached)) {
+    mMetaData.clear();
+    evictObjects(path);
     return reinterpret_cast<T*>(cached.objPtr.get());
   }
 
+  auto start = Clock::now();
   T* ptr = mCCDBAccessor.retrieveFromTFileAny<T>(path, mMetaData, timestamp, &mHeaders, cached.uuid,
                                                  mCreatedNotAfter ? std::to_string(mCreatedNotAfter) : "",
                                                  mCreatedNotBefore ? std::to_string(mCreatedNotBefore) : "");
+  registerFetchTime(start);
   if (ptr) { // new object was shipped, old one (if any) is not valid anymore
-    cached.objPtr.reset(ptr);
-    cached.uuid = mHeaders["ETag"];
-    cached.startvalidity = std::stol(mHeaders["Valid-From"]);
-    cached.endvalidity = std::stol(mHeaders["Valid-Until"]);
+    mStats.nMisses++;
+    mCacheMemory -= cached.size;
+    fillCachedObject(cached, std::shared_ptr<void>(ptr), mHeaders);
+    mCacheMemory += cached.size;
+    evictObjects(path);
   } else if (mHeaders.count("Error")) { // in case of errors the pointer is 0 and headers["Error"] should be set
     clearCache(path);                   // in case of any error clear cache for this object
   } else {                              // the old object is valid
+    mStats.nHits++;
     ptr = reinterpret_cast<T*>(cached.objPtr.get());
   }
   mHeaders.clear();
@@ -180,6 +282,29 @@ T* CCDBManagerInstance::getForTimeStamp(std::string const& path, long timestamp)
   return ptr;
 }
 
+template <typename T>
+void CCDBManagerInstance::prefetch(std::string const& path, long timestamp, std::map<std::string, std::string> metaData)
+{
+  if (!isCachingEnabled() || isPrefetched(path)) {
+    return;
+  }
+  initPrefetchAccessor();
+  auto createdNotAfter = mCreatedNotAfter ? std::to_string(mCreatedNotAfter) : "";
+  auto createdNotBefore = mCreatedNotBefore ? std::to_string(mCreatedNotBefore) : "";
+  auto& request = mPrefetched[path];
+  request.timestamp = timestamp;
+  request.result = std::async(std::launch::async, [api = mPrefetchAccessor.get(), mutex = &mPrefetchMutex, path, timestamp, metaData = std::move(metaData), createdNotAfter, createdNotBefore]() {
+    std::lock_guard<std::mutex> guard(*mutex); // the API instance is not thread safe
+    CachedObject obj;
+    std::map<std::string, std::string> headers;
+    T* ptr = api->retrieveFromTFileAny<T>(path, metaData, timestamp, &headers, "", createdNotAfter, createdNotBefore);
+    if (ptr) {
+      fillCachedObject(obj, std::shared_ptr<void>(ptr), headers);
+    }
+    return obj;
+  }).share();
+}
+
 class BasicCCDBManager : public CCDBManagerInstance
 {
  public:
@@ -13,6 +13,8 @@
 // Created by Sandro Wenzel on 2019-08-14.
 //
 #include "CCDB/BasicCCDBManager.h"
+#include <FairLogger.h>
+#include <TROOT.h>
 #include <string>
 
 namespace o2
@@ -22,8 +24,112 @@ namespace ccdb
 
 void CCDBManagerInstance::setURL(std::string const& url)
 {
+  mPrefetched.clear(); // waits for pending background queries
+  mPrefetchAccessor.reset();
   mCCDBAccessor.init(url);
 }
 
+void CCDBManagerInstance::clearCache()
+{
+  mPrefetched.clear(); // waits for pending background queries
+  mCache.clear();
+  mCacheMemory = 0;
+}
+
+void CCDBManagerInstance::clearCache(std::string const& path)
+{
+  auto entry = mCache.find(path);
+  if (entry != mCache.end()) {
+    mCacheMemory -= entry->second.size;
+    mCache.erase(entry);
+  }
+}
+
+void CCDBManagerInstance::fillCachedObject(CachedObject& cached, std::shared_ptr<void>&& obj, std::map<std::string, std::string>& headers)
+{
+  cached.objPtr = std::move(obj);
+  cached.uuid = headers["ETag"];
+  cached.startvalidity = std::stol(headers["Valid-From"]);
+  cached.endvalidity = std::stol(headers["Valid-Until"]);
+  auto len = headers.find("Content-Length");
+  cached.size = len != headers.end() ? std::stoul(len->second) : 0;
+}
+
+bool CCDBManagerInstance::adoptPrefetched(std::string const& path, long timestamp, CachedObject& cached)
+{
+  auto entry = mPrefetched.find(path);
+  if (entry == mPrefetched.end()) {
+    return false;
+  }
+  auto& request = entry->second;
+  bool ready = request.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+  if (!ready && timestamp < request.timestamp) { // object was requested for later time, don't wait for it
+    return false;
+  }
+  auto start = Clock::now();
+  const auto& obj = request.result.get();
+  if (!ready) {
+    registerFetchTime(start);
+  }
+  bool valid = obj.objPtr && obj.isValid(timestamp);
+  if (valid) {
+    mCacheMemory -= cached.size;
+    auto lastAccess = cached.lastAccess;
+    cached = obj;
+    cached.lastAccess = lastAccess;
+    mCacheMemory += cached.size;
+    mStats.nPrefetchHits++;
+  }
+  if (valid || !obj.objPtr || timestamp >= request.timestamp) { // keep only the object which may be valid for later time
+    mPrefetched.erase(entry);
+  }
+  return valid;
+}
+
+void CCDBManagerInstance::initPrefetchAccessor()
+{
+  if (mPrefetchAccessor) {
+    return;
+  }
+  // the objects are streamed in the background while the caller may use ROOT
+  ROOT::EnableThreadSafety();
+  mPrefetchAccessor = std::make_unique<o2::ccdb::CcdbApi>();
+  mPrefetchAccessor->init(getURL());
+}
+
+void CCDBManagerInstance::registerFetchTime(Clock::time_point start)
+{
+  double dt = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  mStats.fetchTime += dt;
+  if (dt > mStats.maxFetchTime) {
+    mStats.maxFetchTime = dt;
+  }
+}
+
+void CCDBManagerInstance::evictObjects(std::string const& keep)
+{
+  while ((mMaxCachedObjects && mCache.size() > mMaxCachedObjects) || (mMaxCacheMemory && mCacheMemory > mMaxCacheMemory)) {
+    auto lru = mCache.end();
+    for (auto it = mCache.begin(); it != mCache.end(); ++it) {
+      if (it->first != keep && (lru == mCache.end() || it->second.lastAccess < lru->second.lastAccess)) {
+        lru = it;
+      }
+    }
+    if (lru == mCache.end()) { // only the protected object is left
+      break;
+    }
+    LOG(DEBUG) << "Evicting " << lru->first << " from the CCDB cache";
+    mCacheMemory -= lru->second.size;
+    mCache.erase(lru);
+    mStats.nEvictions++;
+  }
+}
+
+void CCDBManagerInstance::printCacheStats() const
+{
+  LOGF(INFO, "CCDB cache: %zu objects, %zu bytes, hits: %zu, misses: %zu, prefetch hits: %zu, evictions: %zu, blocking time: %.3f ms (max %.3f ms)",
+       mCache.size(), mCacheMemory, mStats.nHits, mStats.nMisses, mStats.nPrefetchHits, mStats.nEvictions, mStats.fetchTime, mStats.maxFetchTime);
+}
+
 } // namespace ccdb
 } // namespace o2
@@ -36,6 +36,7 @@
 #include <boost/algorithm/string.hpp>
 #include <iostream>
 #include <mutex>
+#include <cstring>
 #include <boost/interprocess/sync/named_semaphore.hpp>
 
 namespace o2
@@ -46,6 +47,16 @@ namespace ccdb
 using namespace std;
 
 std::mutex gIOMutex; // to protect TMemFile IO operations
+
+namespace
+{
+// ROOT files start with this identifier
+bool isROOTFileContent(const char* content, size_t size)
+{
+  return size >= 4 && std::memcmp(content, "root", 4) == 0;
+}
+} // namespace
+
 unique_ptr<TJAlienCredentials> CcdbApi::mJAlienCredentials = nullptr;
 
 CcdbApi::~CcdbApi()
@@ -785,11 +796,13 @@ void* CcdbApi::downloadAlienContent(std::string const& url, std::type_info const
 void* CcdbApi::interpretAsTMemFileAndExtract(char* contentptr, size_t contentsize, std::type_info const& tinfo) const
 {
   void* result = nullptr;
-  Int_t previousErrorLevel = gErrorIgnoreLevel;
-  gErrorIgnoreLevel = kFatal;
+  // other content is rejected before ROOT reports an error for it, the error level is not changed
+  // since this may run concurrently with other threads (e.g. CCDBManagerInstance::prefetch)
+  if (!isROOTFileContent(contentptr, contentsize)) {
+    return result;
+  }
   std::lock_guard<std::mutex> guard(gIOMutex);
   TMemFile memFile("name", contentptr, contentsize, "READ");
-  gErrorIgnoreLevel = previousErrorLevel;
   if (!memFile.IsZombie()) {
     auto tcl = tinfo2TClass(tinfo);
     result = extractFromTFile(memFile, tcl);
@@ -23,6 +23,10 @@
 #include "CCDB/BasicCCDBManager.h"
 #include "Framework/Logger.h"
 #include <boost/test/unit_test.hpp>
+#include <TFile.h>
+#include <TClass.h>
+#include <filesystem>
+#include <unistd.h>
 
 using namespace o2::ccdb;
 
@@ -122,3 +126,85 @@ BOOST_AUTO_TEST_CASE(TestBasicCCDBManager)
   LOG(INFO) << "Reading A again, it should not be cached: " << *objA;
   BOOST_CHECK(objA && (*objA) != hack); // make sure correct object is loaded
 }
+
+// create local snapshot of the string object with given validity
+void createSnapshot(std::string const& topdir, std::string const& path, std::string const& obj, long start, long stop)
+{
+  std::filesystem::create_directories(topdir + "/" + path);
+  std::map<std::string, std::string> headers{{"Valid-From", std::to_string(start)}, {"Valid-Until", std::to_string(stop)},
+                                             {"ETag", path}, {"Content-Length", "1000"}};
+  TFile fl((topdir + "/" + path + "/snapshot.root").c_str(), "RECREATE");
+  fl.WriteObjectAny(&obj, TClass::GetClass(typeid(obj)), CcdbApi::CCDBOBJECT_ENTRY);
+  fl.WriteObjectAny(&headers, TClass::GetClass(typeid(headers)), CcdbApi::CCDBMETA_ENTRY);
+  fl.Close();
+}
+
+BOOST_AUTO_TEST_CASE(TestCCDBManagerPrefetchAndLRU)
+{
+  const std::string topdir = std::filesystem::temp_directory_path().string() + "/ccdbSnapshot_" + std::to_string(getpid());
+  long start = 1000, stop = 2000;
+  createSnapshot(topdir, "Test/A", "objA", start, stop);
+  createSnapshot(topdir, "Test/B", "objB", stop, stop + (stop - start)); // next validity interval
+  createSnapshot(topdir, "Test/C", "objC", start, stop);
+
+  CCDBManagerInstance cdb("file://" + topdir);
+  cdb.setLocalObjectValidityChecking(true);
+  cdb.setTimestamp((start + stop) / 2);
+
+  // prefetched object is adopted by the cache at the 1st request
+  cdb.prefetch<std::string>("Test/A", (start + stop) / 2);
+  BOOST_CHECK(cdb.isPrefetched("Test/A"));
+  auto* objA = cdb.get<std::string>("Test/A");
+  BOOST_CHECK(objA && (*objA) == "objA");
+  BOOST_CHECK(!cdb.isPrefetched("Test/A"));
+  BOOST_CHECK(cdb.getCacheStats().nPrefetchHits == 1);
+  BOOST_CHECK(cdb.getCacheStats().nMisses == 0);
+
+  // object valid for the timestamp is served from the cache
+  objA = cdb.get<std::string>("Test/A");
+  BOOST_CHECK(objA && (*objA) == "objA");
+  BOOST_CHECK(cdb.getCacheStats().nHits == 1);
+
+  // object prefetched for later time is kept until needed
+  cdb.prefetch<std::string>("Test/B", stop + 1);
+  auto* objB = cdb.get<std::string>("Test/B"); // snapshot ignores the timestamp, B is loaded synchronously
+  BOOST_CHECK(objB && (*objB) == "objB");
+  BOOST_CHECK(cdb.getCacheStats().nMisses == 1);
+  BOOST_CHECK(cdb.isPrefetched("Test/B"));
+
+  // LRU eviction: A was used least recently
+  BOOST_CHECK(cdb.getNCachedObjects() == 2);
+  BOOST_CHECK(cdb.getCacheMemory() == 2000);
+  cdb.setMaxCachedObjects(2);
+  cdb.get<std::string>("Test/C");
+  BOOST_CHECK(cdb.getNCachedObjects() == 2);
+  BOOST_CHECK(cdb.getCacheStats().nMisses == 2);
+  BOOST_CHECK(cdb.getCacheStats().nEvictions == 1);
+  cdb.get<std::string>("Test/C"); // C is cached
+  BOOST_CHECK(cdb.getCacheStats().nHits == 2);
+  cdb.setMaxCacheMemory(1000); // B is evicted
+  BOOST_CHECK(cdb.getNCachedObjects() == 1);
+  BOOST_CHECK(cdb.getCacheMemory() == 1000);
+  cdb.get<std::string>("Test/C");
+  BOOST_CHECK(cdb.getCacheStats().nHits == 3);
+  BOOST_CHECK(cdb.getCacheStats().nEvictions == 2);
+  cdb.printCacheStats();
+
+  cdb.clearCache();
+  BOOST_CHECK(cdb.getNCachedObjects() == 0);
+  BOOST_CHECK(!cdb.isPrefetched("Test/B"));
+
+  // several pending prefetch requests share the background API instance
+  cdb.setMaxCachedObjects(0);
+  cdb.setMaxCacheMemory(0);
+  auto nPrefetchHits = cdb.getCacheStats().nPrefetchHits;
+  for (auto obj : {"A", "C"}) {
+    cdb.prefetch<std::string>(std::string("Test/") + obj, (start + stop) / 2);
+  }
+  for (auto obj : {"A", "C"}) {
+    auto* ptr = cdb.get<std::string>(std::string("Test/") + obj);
+    BOOST_CHECK(ptr && (*ptr) == std::string("obj") + obj);
+  }
+  BOOST_CHECK(cdb.getCacheStats().nPrefetchHits == nPrefetchHits + 2);
+  std::filesystem::remove_all(topdir);
+}
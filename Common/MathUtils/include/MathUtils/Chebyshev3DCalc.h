@@ -170,6 +170,9 @@ class Chebyshev3DCalc : public TNamed
   Double_t Eval(const Double_t* par) const;
 
  private:
+  /// Returns a scratch array of at least size elements, private to the calling thread so that the evaluation is reentrant
+  static Float_t* getTemporaryCoefficients(int size);
+
   Int_t mNumberOfCoefficients;    ///< total number of coeeficients
   Int_t mNumberOfRows;            ///< number of significant rows in the 3D coeffs matrix
   Int_t mNumberOfColumns;         ///< max number of significant cols in the 3D coeffs matrix
@@ -187,8 +190,8 @@ class Chebyshev3DCalc : public TNamed
   // coeffs for col/row
   Float_t* mCoefficients; //[mNumberOfCoefficients] array of Chebyshev coefficients
 
-  Float_t* mTemporaryCoefficients2D; //[mNumberOfColumns] temp. coeffs for 2d summation
-  Float_t* mTemporaryCoefficients1D; //[mNumberOfRows] temp. coeffs for 1d summation
+  Float_t* mTemporaryCoefficients2D; //[mNumberOfColumns] unused, kept for I/O: see getTemporaryCoefficients
+  Float_t* mTemporaryCoefficients1D; //[mNumberOfRows] unused, kept for I/O: see getTemporaryCoefficients
 
   ClassDefOverride(o2::math_utils::Chebyshev3DCalc,
                    2) // Class for interpolation of 3D->1 function by Chebyshev parametrization
@@ -217,32 +220,36 @@ inline Float_t Chebyshev3DCalc::chebyshevEvaluation1D(Float_t x, const Float_t*
 /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
 inline Float_t Chebyshev3DCalc::Eval(const Float_t* par) const
 {
+  Float_t* temporaryCoefficients2D = getTemporaryCoefficients(mNumberOfColumns + mNumberOfRows);
+  Float_t* temporaryCoefficients1D = temporaryCoefficients2D + mNumberOfColumns;
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
+      temporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
     }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+    temporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], temporaryCoefficients2D, nCLoc);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  return chebyshevEvaluation1D(par[0], temporaryCoefficients1D, mNumberOfRows);
 }
 
 /// Evaluates Chebyshev parameterization for 3D function.
 /// VERY IMPORTANT: par must contain the function arguments ALREADY MAPPED to [-1:1] interval
 inline Double_t Chebyshev3DCalc::Eval(const Double_t* par) const
 {
+  Float_t* temporaryCoefficients2D = getTemporaryCoefficients(mNumberOfColumns + mNumberOfRows);
+  Float_t* temporaryCoefficients1D = temporaryCoefficients2D + mNumberOfColumns;
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     int col0 = mColumnAtRowBeginning[id0];  // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
-      mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
+      temporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], mCoefficientBound2D0[id]);
     }
-    mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+    temporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], temporaryCoefficients2D, nCLoc);
   }
-  return chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  return chebyshevEvaluation1D(par[0], temporaryCoefficients1D, mNumberOfRows);
 }
 } // namespace math_utils
 } // namespace o2
@@ -17,6 +17,7 @@
 #include <TSystem.h> // for TSystem, gSystem
 #include "TNamed.h"  // for TNamed
 #include "TString.h" // for TString, TString::EStripType::kBoth
+#include <vector>
 
 using namespace o2::math_utils;
 
@@ -205,11 +206,13 @@ void Chebyshev3DCalc::Print(const Option_t*) const
 
 Float_t Chebyshev3DCalc::evaluateDerivative(int dim, const Float_t* par) const
 {
+  Float_t* temporaryCoefficients2D = getTemporaryCoefficients(mNumberOfColumns + mNumberOfRows);
+  Float_t* temporaryCoefficients1D = temporaryCoefficients2D + mNumberOfColumns;
   int ncfRC;
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     if (!nCLoc) {
-      mTemporaryCoefficients1D[id0] = 0;
+      temporaryCoefficients1D[id0] = 0;
       continue;
     }
     //
@@ -217,62 +220,73 @@ Float_t Chebyshev3DCalc::evaluateDerivative(int dim, const Float_t* par) const
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
       if (!(ncfRC = mCoefficientBound2D0[id])) {
-        mTemporaryCoefficients2D[id1] = 0;
+        temporaryCoefficients2D[id1] = 0;
         continue;
       }
       if (dim == 2) {
-        mTemporaryCoefficients2D[id1] =
+        temporaryCoefficients2D[id1] =
           chebyshevEvaluation1Derivative(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
       } else {
-        mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
+        temporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
       }
     }
     if (dim == 1) {
-      mTemporaryCoefficients1D[id0] = chebyshevEvaluation1Derivative(par[1], mTemporaryCoefficients2D, nCLoc);
+      temporaryCoefficients1D[id0] = chebyshevEvaluation1Derivative(par[1], temporaryCoefficients2D, nCLoc);
     } else {
-      mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+      temporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], temporaryCoefficients2D, nCLoc);
     }
   }
-  return (dim == 0) ? chebyshevEvaluation1Derivative(par[0], mTemporaryCoefficients1D, mNumberOfRows)
-                    : chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+  return (dim == 0) ? chebyshevEvaluation1Derivative(par[0], temporaryCoefficients1D, mNumberOfRows)
+                    : chebyshevEvaluation1D(par[0], temporaryCoefficients1D, mNumberOfRows);
 }
 
 Float_t Chebyshev3DCalc::evaluateDerivative2(int dim1, int dim2, const Float_t* par) const
 {
+  Float_t* temporaryCoefficients2D = getTemporaryCoefficients(mNumberOfColumns + mNumberOfRows);
+  Float_t* temporaryCoefficients1D = temporaryCoefficients2D + mNumberOfColumns;
   Bool_t same = dim1 == dim2;
   int ncfRC;
   for (int id0 = mNumberOfRows; id0--;) {
     int nCLoc = mNumberOfColumnsAtRow[id0]; // number of significant coefs on this row
     if (!nCLoc) {
-      mTemporaryCoefficients1D[id0] = 0;
+      temporaryCoefficients1D[id0] = 0;
       continue;
     }
     int col0 = mColumnAtRowBeginning[id0]; // beginning of local column in the 2D boundary matrix
     for (int id1 = nCLoc; id1--;) {
       int id = id1 + col0;
       if (!(ncfRC = mCoefficientBound2D0[id])) {
-        mTemporaryCoefficients2D[id1] = 0;
+        temporaryCoefficients2D[id1] = 0;
         continue;
       }
       if (dim1 == 2 || dim2 == 2) {
-        mTemporaryCoefficients2D[id1] =
+        temporaryCoefficients2D[id1] =
           same ? chebyshevEvaluation1Derivative2(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC)
                : chebyshevEvaluation1Derivative(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
       } else {
-        mTemporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
+        temporaryCoefficients2D[id1] = chebyshevEvaluation1D(par[2], mCoefficients + mCoefficientBound2D1[id], ncfRC);
       }
     }
     if (dim1 == 1 || dim2 == 1) {
-      mTemporaryCoefficients1D[id0] = same ? chebyshevEvaluation1Derivative2(par[1], mTemporaryCoefficients2D, nCLoc)
-                                           : chebyshevEvaluation1Derivative(par[1], mTemporaryCoefficients2D, nCLoc);
+      temporaryCoefficients1D[id0] = same ? chebyshevEvaluation1Derivative2(par[1], temporaryCoefficients2D, nCLoc)
+                                           : chebyshevEvaluation1Derivative(par[1], temporaryCoefficients2D, nCLoc);
     } else {
-      mTemporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], mTemporaryCoefficients2D, nCLoc);
+      temporaryCoefficients1D[id0] = chebyshevEvaluation1D(par[1], temporaryCoefficients2D, nCLoc);
     }
   }
   return (dim1 == 0 || dim2 == 0)
-           ? (same ? chebyshevEvaluation1Derivative2(par[0], mTemporaryCoefficients1D, mNumberOfRows)
-                   : chebyshevEvaluation1Derivative(par[0], mTemporaryCoefficients1D, mNumberOfRows))
-           : chebyshevEvaluation1D(par[0], mTemporaryCoefficients1D, mNumberOfRows);
+           ? (same ? chebyshevEvaluation1Derivative2(par[0], temporaryCoefficients1D, mNumberOfRows)
+                   : chebyshevEvaluation1Derivative(par[0], temporaryCoefficients1D, mNumberOfRows))
+           : chebyshevEvaluation1D(par[0], temporaryCoefficients1D, mNumberOfRows);
+}
+
+Float_t* Chebyshev3DCalc::getTemporaryCoefficients(int size)
+{
+  thread_local std::vector<Float_t> temporaryCoefficients{};
+  if (temporaryCoefficients.size() < static_cast<size_t>(size)) {
+    temporaryCoefficients.resize(size);
+  }
+  return temporaryCoefficients.data();
 }
 
 #ifdef _INC_CREATION_Chebyshev3D_
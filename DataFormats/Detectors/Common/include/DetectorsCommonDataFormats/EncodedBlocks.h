@@ -48,6 +48,27 @@ struct is_iterator<T, std::enable_if_t<
 
 template <class T>
 inline constexpr bool is_iterator_v = is_iterator<T>::value;
+
+/// call f with std::integral_constant<size_t, nStreams> matching the runtime number of interleaved rANS streams
+template <typename F>
+inline decltype(auto) dispatchInterleaving(uint8_t nStreams, F&& f)
+{
+  switch (nStreams) {
+    case 1:
+      return f(std::integral_constant<size_t, 1>{});
+    case 0: // legacy data
+    case 2:
+      return f(std::integral_constant<size_t, 2>{});
+    case 4:
+      return f(std::integral_constant<size_t, 4>{});
+    case 8:
+      return f(std::integral_constant<size_t, 8>{});
+    case 16:
+      return f(std::integral_constant<size_t, 16>{});
+    default:
+      throw std::runtime_error(fmt::format("unsupported number of interleaved rANS streams: {}", int(nStreams)));
+  }
+}
 } // namespace detail
 
 using namespace o2::rans;
@@ -93,11 +114,12 @@ inline size_t calculatePaddedSize(size_t nElems) noexcept
 ///>>======================== Auxiliary classes =======================>>
 
 struct ANSHeader {
-  uint8_t majorVersion;
-  uint8_t minorVersion;
+  uint8_t majorVersion = 0;
+  uint8_t minorVersion = 0;
+  uint8_t nStreams = 0; // number of interleaved rANS states (1, 2, 4, 8 or 16), 0 for data written before it was introduced (2 states)
 
-  void clear() { majorVersion = minorVersion = 0; }
-  ClassDefNV(ANSHeader, 1);
+  void clear() { majorVersion = minorVersion = nStreams = 0; }
+  ClassDefNV(ANSHeader, 2);
 };
 
 struct Metadata {
@@ -424,6 +446,22 @@ class EncodedBlocks
   template <typename input_IT, typename buffer_T>
   void encode(const input_IT srcBegin, const input_IT srcEnd, int slot, uint8_t symbolTablePrecision, Metadata::OptStore opt, buffer_T* buffer = nullptr, const void* encoderExt = nullptr);
 
+  /// encode vector src to the slot of a standalone container created in the scratch buffer, to be moved to the final container
+  /// by adoptSlot. Does not access any other container, so that independent slots can be encoded concurrently
+  template <typename VE, typename buffer_T>
+  static void encodeToScratch(buffer_T& scratch, const ANSHeader& ansHeader, const VE& src, int slot, uint8_t symbolTablePrecision, Metadata::OptStore opt, const void* encoderExt = nullptr)
+  {
+    encodeToScratch(scratch, ansHeader, std::begin(src), std::end(src), slot, symbolTablePrecision, opt, encoderExt);
+  }
+
+  /// encode the range of iterators to the slot of a standalone container created in the scratch buffer
+  template <typename input_IT, typename buffer_T>
+  static void encodeToScratch(buffer_T& scratch, const ANSHeader& ansHeader, const input_IT srcBegin, const input_IT srcEnd, int slot, uint8_t symbolTablePrecision, Metadata::OptStore opt, const void* encoderExt = nullptr);
+
+  /// copy the slot of the container filled by encodeToScratch to the same slot of the container in the buffer (expanded if needed)
+  template <typename buffer_T>
+  static void adoptSlot(buffer_T& buffer, const EncodedBlocks& scratch, int slot);
+
   /// decode block at provided slot to destination vector (will be resized as needed)
   template <class container_T, class container_IT = typename container_T::iterator>
   void decode(container_T& dest, int slot, const void* decoderExt = nullptr) const;
@@ -766,7 +804,9 @@ void EncodedBlocks<H, N, W>::decode(D_IT dest,                    // iterator to
         // to D-word array
         literals = std::vector<dest_t>{reinterpret_cast<const dest_t*>(block.getLiterals()), reinterpret_cast<const dest_t*>(block.getLiterals()) + md.nLiterals};
       }
-      decoder->process(block.getData() + block.getNData(), dest, md.messageLength, literals);
+      detail::dispatchInterleaving(mANSHeader.nStreams, [&](auto interleaving) {
+        decoder->template process<decltype(interleaving)::value>(block.getData() + block.getNData(), dest, md.messageLength, literals);
+      });
     } else { // data was stored as is
       using destPtr_t = typename std::iterator_traits<D_IT>::pointer;
       destPtr_t srcBegin = reinterpret_cast<destPtr_t>(block.payload);
@@ -777,6 +817,41 @@ void EncodedBlocks<H, N, W>::decode(D_IT dest,                    // iterator to
   }
 }
 
+///_____________________________________________________________________________
+template <typename H, int N, typename W>
+template <typename input_IT, typename buffer_T>
+void EncodedBlocks<H, N, W>::encodeToScratch(buffer_T& scratch,            // buffer for the standalone container
+                                             const ANSHeader& ansHeader,   // ANS header of the final container
+                                             const input_IT srcBegin,      // iterator begin of source message
+                                             const input_IT srcEnd,        // iterator end of source message
+                                             int slot,                     // slot in encoded data to fill
+                                             uint8_t symbolTablePrecision, // encoding into
+                                             Metadata::OptStore opt,       // option for data compression
+                                             const void* encoderExt)       // optional external encoder
+{
+  auto tmp = create(scratch);
+  tmp->setANSHeader(ansHeader);
+  tmp->mRegistry.nFilledBlocks = slot; // only this slot will be filled
+  tmp->encode(srcBegin, srcEnd, slot, symbolTablePrecision, opt, &scratch, encoderExt);
+}
+
+///_____________________________________________________________________________
+template <typename H, int N, typename W>
+template <typename buffer_T>
+void EncodedBlocks<H, N, W>::adoptSlot(buffer_T& buffer, const EncodedBlocks& scratch, int slot)
+{
+  auto* dest = get(buffer.data());
+  assert(slot == dest->mRegistry.nFilledBlocks);
+  const auto& srcBlock = scratch.mBlocks[slot];
+  const size_t needed = estimateBlockSize(srcBlock.getNStored());
+  if (needed > dest->getFreeSize()) {
+    dest = expand(buffer, dest->size() + (needed - dest->getFreeSize()));
+  }
+  dest->mMetadata[slot] = scratch.mMetadata[slot];
+  dest->mBlocks[slot].store(srcBlock.getNDict(), srcBlock.getNData(), srcBlock.getNLiterals(), srcBlock.getDict(), srcBlock.getData(), srcBlock.getLiterals());
+  dest->mRegistry.nFilledBlocks++;
+}
+
 ///_____________________________________________________________________________
 template <typename H, int N, typename W>
 template <typename input_IT, typename buffer_T>
@@ -802,6 +877,7 @@ void EncodedBlocks<H, N, W>::encode(const input_IT srcBegin,      // iterator be
   // fill a new block
   assert(slot == mRegistry.nFilledBlocks);
   mRegistry.nFilledBlocks++;
+  const uint8_t nStreams = mANSHeader.nStreams; // note: "this" might be not valid after expandStorage call!!!
 
   const size_t messageLength = std::distance(srcBegin, srcEnd);
   // cover three cases:
@@ -865,7 +941,9 @@ void EncodedBlocks<H, N, W>::encode(const input_IT srcBegin,      // iterator be
     // directly encode source message into block buffer.
     storageBuffer_t* const blockBufferBegin = thisBlock->getCreateData();
     const size_t maxBufferSize = thisBlock->registry->getFreeSize(); // note: "this" might be not valid after expandStorage call!!!
-    const auto encodedMessageEnd = encoder->process(srcBegin, srcEnd, blockBufferBegin, literals);
+    const auto encodedMessageEnd = detail::dispatchInterleaving(nStreams, [&](auto interleaving) {
+      return encoder->template process<decltype(interleaving)::value>(srcBegin, srcEnd, blockBufferBegin, literals);
+    });
     rans::utils::checkBounds(encodedMessageEnd, blockBufferBegin + maxBufferSize);
     dataSize = encodedMessageEnd - thisBlock->getDataPointer();
     thisBlock->setNData(dataSize);
@@ -0,0 +1,74 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test EncodedBlocks
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+#include "DetectorsCommonDataFormats/EncodedBlocks.h"
+#include <TRandom3.h>
+#include <vector>
+
+using namespace o2::ctf;
+
+struct TestHeader {
+  int dummy = 0;
+};
+using TestBlocks = EncodedBlocks<TestHeader, 3>;
+
+BOOST_DATA_TEST_CASE(EncodeDecodeInterleaved, boost::unit_test::data::make({0, 1, 2, 4, 8, 16}), nStreams)
+{
+  // an entropy-coded column of each input type and a stored one, of lengths which are not multiple of the number of streams
+  TRandom3 rnd(1234);
+  std::vector<uint16_t> shorts(10001);
+  std::vector<int32_t> ints(1237);
+  std::vector<uint8_t> bytes(77);
+  for (auto& v : shorts) {
+    v = rnd.Poisson(100);
+  }
+  for (auto& v : ints) {
+    v = rnd.Gaus(0, 1e4);
+  }
+  for (auto& v : bytes) {
+    v = rnd.Integer(256);
+  }
+
+  std::vector<BufferType> buff;
+  TestBlocks::create(buff);
+  TestBlocks::get(buff.data())->getANSHeader().nStreams = nStreams;
+  TestBlocks::get(buff.data())->encode(shorts, 0, 16, Metadata::OptStore::EENCODE, &buff);
+  TestBlocks::get(buff.data())->encode(ints, 1, 16, Metadata::OptStore::EENCODE, &buff);
+  TestBlocks::get(buff.data())->encode(bytes, 2, 16, Metadata::OptStore::NONE, &buff);
+
+  // decode the image of the buffer, as done when reading the blocks from a message
+  const auto image = TestBlocks::getImage(buff.data());
+  BOOST_CHECK_EQUAL(int(image.getANSHeader().nStreams), nStreams);
+
+  std::vector<uint16_t> shortsD;
+  std::vector<int32_t> intsD;
+  std::vector<uint8_t> bytesD;
+  image.decode(shortsD, 0);
+  image.decode(intsD, 1);
+  image.decode(bytesD, 2);
+  BOOST_CHECK_EQUAL_COLLECTIONS(shortsD.begin(), shortsD.end(), shorts.begin(), shorts.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(intsD.begin(), intsD.end(), ints.begin(), ints.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS(bytesD.begin(), bytesD.end(), bytes.begin(), bytes.end());
+}
+
+BOOST_AUTO_TEST_CASE(UnsupportedInterleaving)
+{
+  std::vector<uint16_t> shorts(100, 1);
+  std::vector<BufferType> buff;
+  TestBlocks::create(buff);
+  TestBlocks::get(buff.data())->getANSHeader().nStreams = 3;
+  BOOST_CHECK_THROW(TestBlocks::get(buff.data())->encode(shorts, 0, 16, Metadata::OptStore::EENCODE, &buff), std::runtime_error);
+}
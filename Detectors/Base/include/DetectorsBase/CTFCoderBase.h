@@ -17,11 +17,16 @@
 #define _ALICEO2_CTFCODER_BASE_H_
 
 #include <memory>
+#include <functional>
+#include <array>
+#include <vector>
+#include <stdexcept>
 #include <TFile.h>
 #include <TTree.h>
 #include "DetectorsCommonDataFormats/DetID.h"
 #include "DetectorsCommonDataFormats/NameConf.h"
 #include "DetectorsCommonDataFormats/CTFDictHeader.h"
+#include "DetectorsCommonDataFormats/EncodedBlocks.h"
 #include "rANS/rans.h"
 
 namespace o2
@@ -86,6 +91,77 @@ class CTFCoderBase
     }
   }
 
+  void setNThreads(int n) { mNThreads = n > 0 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
+
+  /// set the number of interleaved rANS states of the encoded blocks (1, 2, 4, 8 or 16), 0 for the legacy format with 2 states
+  void setANSNStreams(int n)
+  {
+    if (n != 0 && n != 1 && n != 2 && n != 4 && n != 8 && n != 16) {
+      throw std::invalid_argument(fmt::format("unsupported number of interleaved rANS streams: {}", n));
+    }
+    mANSNStreams = n;
+  }
+  int getANSNStreams() const { return mANSNStreams; }
+
+  /// Encoder of the CTF columns. With a single thread every column is encoded directly to the output buffer, otherwise
+  /// the columns are encoded concurrently to standalone scratch containers, whose encoded blocks are copied to the output buffer in the slot order.
+  /// The columns may be provided as containers or as ranges of iterators (e.g. of CTFHelper), in the latter case
+  /// the values are generated on the fly by the encoder and no intermediate vectors are created.
+  template <typename CTF, typename VEC>
+  class ColumnsEncoder
+  {
+   public:
+    using MD = o2::ctf::Metadata::OptStore;
+
+    ColumnsEncoder(const CTFCoderBase& coder, VEC& buff, const MD* optField) : mCoder(coder), mBuff(buff), mOptField(optField)
+    {
+      CTF::get(buff.data())->getANSHeader().nStreams = coder.mANSNStreams;
+      mANSHeader = CTF::get(buff.data())->getANSHeader();
+    }
+
+    template <typename IT>
+    void add(const IT beg, const IT end, int slot, uint8_t bits)
+    {
+      const void* encoder = mCoder.mCoders[slot].get();
+      if (mCoder.mNThreads > 1) {
+        mJobs.emplace_back([this, beg, end, slot, bits, encoder]() { CTF::encodeToScratch(mScratch[slot], mANSHeader, beg, end, slot, bits, mOptField[slot], encoder); });
+      } else { // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer
+        CTF::get(mBuff.data())->encode(beg, end, slot, bits, mOptField[slot], &mBuff, encoder);
+      }
+    }
+
+    template <typename C>
+    void add(const C& column, int slot, uint8_t bits)
+    {
+      add(std::begin(column), std::end(column), slot, bits);
+    }
+
+    /// run pending concurrent encodings and move their results to the output buffer
+    void finalize()
+    {
+      if (mJobs.empty()) {
+        return;
+      }
+      mCoder.runJobs(mJobs);
+      mJobs.clear();
+      for (int slot = 0; slot < CTF::getNBlocks(); slot++) {
+        if (!mScratch[slot].empty()) {
+          CTF::adoptSlot(mBuff, *CTF::get(mScratch[slot].data()), slot);
+          std::vector<o2::ctf::BufferType>().swap(mScratch[slot]);
+        }
+      }
+    }
+
+   private:
+    const CTFCoderBase& mCoder;
+    VEC& mBuff;
+    const MD* mOptField = nullptr;
+    o2::ctf::ANSHeader mANSHeader;
+    std::vector<std::function<void()>> mJobs;
+    std::array<std::vector<o2::ctf::BufferType>, CTF::getNBlocks()> mScratch;
+  };
+
  protected:
   std::string getPrefix() const { return o2::utils::Str::concat_string(mDet.getName(), "_CTF: "); }
   void assignDictVersion(CTFDictHeader& h) const
@@ -95,12 +171,16 @@ class CTFCoderBase
     }
   }
   void checkDictVersion(const CTFDictHeader& h) const;
+  /// run independent jobs (e.g. encoding of different slots to scratch containers) on mNThreads threads
+  void runJobs(const std::vector<std::function<void()>>& jobs) const;
 
   std::vector<std::shared_ptr<void>> mCoders; // encoders/decoders
   DetID mDet;
   CTFDictHeader mExtHeader; // external dictionary header
+  int mNThreads = 1;        // number of threads for runJobs
+  uint8_t mANSNStreams = 0; // number of interleaved rANS states written to the ANS header of the encoded CTF
 
-  ClassDefNV(CTFCoderBase, 1);
+  ClassDefNV(CTFCoderBase, 2);
 };
 
 } // namespace ctf
@@ -114,6 +114,12 @@ class PropagatorImpl
                                    gpu::gpustd::array<value_type, 2>* dca = nullptr, track::TrackLTIntegral* tofInfo = nullptr,
                                    int signCorr = 0, value_type maxD = 999.f) const;
 
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+  // true if tracks can be propagated concurrently with these settings: the TGeo material queries and the full field map
+  // (used when neither the fast field nor the GPU field is set) are not reentrant
+  bool isThreadSafe(MatCorrType matCorr, bool bzOnly = false) const;
+#endif
+
   PropagatorImpl(PropagatorImpl const&) = delete;
   PropagatorImpl(PropagatorImpl&&) = delete;
   PropagatorImpl& operator=(PropagatorImpl const&) = delete;
@@ -16,6 +16,11 @@
 #include "DetectorsCommonDataFormats/CTFHeader.h"
 #include "DetectorsBase/CTFCoderBase.h"
 #include <filesystem>
+#include <exception>
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
 
 using namespace o2::ctf;
 
@@ -73,3 +78,24 @@ void CTFCoderBase::checkDictVersion(const CTFDictHeader& h) const
     }
   }
 }
+
+void CTFCoderBase::runJobs(const std::vector<std::function<void()>>& jobs) const
+{
+  // exceptions must not escape the parallel region, rethrow the 1st one afterwards
+  std::vector<std::exception_ptr> errors(jobs.size());
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int i = 0; i < (int)jobs.size(); i++) {
+    try {
+      jobs[i]();
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
+  for (auto& err : errors) {
+    if (err) {
+      std::rethrow_exception(err);
+    }
+  }
+}
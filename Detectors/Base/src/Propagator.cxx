@@ -573,6 +573,17 @@ GPUd() void PropagatorImpl<value_T>::estimateLTFast(o2::track::TrackLTIntegral&
   lt.addStep(length, trc.getP2Inv());
 }
 
+#if !defined(GPUCA_GPUCODE) && !defined(GPUCA_STANDALONE)
+//_______________________________________________________________________
+template <typename value_T>
+bool PropagatorImpl<value_T>::isThreadSafe(MatCorrType matCorr, bool bzOnly) const
+{
+  bool useTGeo = matCorr == MatCorrType::USEMatCorrTGeo || (matCorr == MatCorrType::USEMatCorrLUT && !mMatLUT);
+  bool useFullField = !bzOnly && !mGPUField && !mFieldFast;
+  return !useTGeo && !useFullField;
+}
+#endif
+
 //____________________________________________________________
 template <typename value_T>
 GPUd() MatBudget PropagatorImpl<value_T>::getMatBudget(PropagatorImpl<value_type>::MatCorrType corrType, const math_utils::Point3D<value_type>& p0, const math_utils::Point3D<value_type>& p1) const
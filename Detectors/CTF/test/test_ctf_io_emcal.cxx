@@ -22,6 +22,7 @@
 #include <TStopwatch.h>
 #include <TSystem.h>
 #include <cstring>
+#include <algorithm>
 
 using namespace o2::emcal;
 
@@ -57,6 +58,23 @@ BOOST_AUTO_TEST_CASE(CTFTest)
   sw.Stop();
   LOG(INFO) << "Compressed in " << sw.CpuTime() << " s";
 
+  // concurrent encoding of the columns generated by the helper iterators must produce identical payloads
+  {
+    std::vector<o2::ctf::BufferType> vecMT;
+    CTFCoder coder;
+    coder.setNThreads(4);
+    coder.encode(vecMT, triggers, cells);
+    const auto* ctf = o2::emcal::CTF::get(vec.data());
+    const auto* ctfMT = o2::emcal::CTF::get(vecMT.data());
+    for (int ib = 0; ib < o2::emcal::CTF::getNBlocks(); ib++) {
+      const auto& bl = ctf->getBlock(ib);
+      const auto& blMT = ctfMT->getBlock(ib);
+      BOOST_CHECK(ctf->getMetadata(ib).messageLength == ctfMT->getMetadata(ib).messageLength);
+      BOOST_CHECK(bl.getNStored() == blMT.getNStored());
+      BOOST_CHECK(std::equal(bl.payload, bl.payload + bl.getNStored(), blMT.payload));
+    }
+  }
+
   // writing
   {
     sw.Start();
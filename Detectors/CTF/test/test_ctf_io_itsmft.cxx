@@ -23,6 +23,7 @@
 #include <TRandom.h>
 #include <TStopwatch.h>
 #include <cstring>
+#include <algorithm>
 
 using namespace o2::itsmft;
 
@@ -77,6 +78,23 @@ BOOST_AUTO_TEST_CASE(CompressedClustersTest)
   sw.Stop();
   LOG(INFO) << "Compressed in " << sw.CpuTime() << " s";
 
+  // concurrent encoding of the blocks must produce identical payloads
+  {
+    std::vector<o2::ctf::BufferType> vecMT;
+    CTFCoder coder(o2::detectors::DetID::ITS);
+    coder.setNThreads(4);
+    coder.encode(vecMT, rofRecVec, cclusVec, pattVec);
+    const auto* ctf = o2::itsmft::CTF::get(vec.data());
+    const auto* ctfMT = o2::itsmft::CTF::get(vecMT.data());
+    for (int ib = 0; ib < o2::itsmft::CTF::getNBlocks(); ib++) {
+      const auto& bl = ctf->getBlock(ib);
+      const auto& blMT = ctfMT->getBlock(ib);
+      BOOST_CHECK(ctf->getMetadata(ib).messageLength == ctfMT->getMetadata(ib).messageLength);
+      BOOST_CHECK(bl.getNStored() == blMT.getNStored());
+      BOOST_CHECK(std::equal(bl.payload, bl.payload + bl.getNStored(), blMT.payload));
+    }
+  }
+
   // writing
   {
     sw.Start();
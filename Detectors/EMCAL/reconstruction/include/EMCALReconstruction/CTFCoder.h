@@ -83,8 +83,9 @@ void CTFCoder::encode(VEC& buff, const gsl::span<const TriggerRecord>& trigData,
   assignDictVersion(static_cast<o2::ctf::CTFDictHeader&>(ec->getHeader()));
   ec->getANSHeader().majorVersion = 0;
   ec->getANSHeader().minorVersion = 1;
-  // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
-#define ENCODEEMC(beg, end, slot, bits) CTF::get(buff.data())->encode(beg, end, int(slot), bits, optField[int(slot)], &buff, mCoders[int(slot)].get());
+  // the columns are generated by the helper iterators during the encoding
+  ColumnsEncoder<CTF, VEC> columns(*this, buff, optField);
+#define ENCODEEMC(beg, end, slot, bits) columns.add(beg, end, int(slot), bits);
   // clang-format off
   ENCODEEMC(helper.begin_bcIncTrig(),    helper.end_bcIncTrig(),     CTF::BLC_bcIncTrig,    0);
   ENCODEEMC(helper.begin_orbitIncTrig(), helper.end_orbitIncTrig(),  CTF::BLC_orbitIncTrig, 0);
@@ -95,6 +96,7 @@ void CTFCoder::encode(VEC& buff, const gsl::span<const TriggerRecord>& trigData,
   ENCODEEMC(helper.begin_energy(),      helper.end_energy(),       CTF::BLC_energy,      0);
   ENCODEEMC(helper.begin_status(),      helper.end_status(),       CTF::BLC_status,      0);
   // clang-format on
+  columns.finalize();
   CTF::get(buff.data())->print(getPrefix());
 }
 
@@ -37,6 +37,8 @@ void EntropyEncoderSpec::init(o2::framework::InitContext& ic)
   if (!dictPath.empty() && dictPath != "none") {
     mCTFCoder.createCoders(dictPath, o2::ctf::CTFCoderBase::OpType::Encoder);
   }
+  mCTFCoder.setNThreads(ic.options().get<int>("nthreads"));
+  mCTFCoder.setANSNStreams(ic.options().get<int>("ans-streams"));
 }
 
 void EntropyEncoderSpec::run(ProcessingContext& pc)
@@ -73,7 +75,9 @@ DataProcessorSpec getEntropyEncoderSpec()
     inputs,
     Outputs{{"EMC", "CTFDATA", 0, Lifetime::Timeframe}},
     AlgorithmSpec{adaptFromTask<EntropyEncoderSpec>()},
-    Options{{"ctf-dict", VariantType::String, o2::base::NameConf::getCTFDictFileName(), {"File of CTF encoding dictionary"}}}};
+    Options{{"ctf-dict", VariantType::String, o2::base::NameConf::getCTFDictFileName(), {"File of CTF encoding dictionary"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads for concurrent encoding of CTF blocks"}},
+            {"ans-streams", VariantType::Int, 0, {"Number of interleaved rANS streams (1, 2, 4, 8 or 16), 0 for the default format"}}}};
 }
 
 } // namespace emcal
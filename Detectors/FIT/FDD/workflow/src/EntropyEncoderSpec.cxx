@@ -37,6 +37,7 @@ void EntropyEncoderSpec::init(o2::framework::InitContext& ic)
   if (!dictPath.empty() && dictPath != "none") {
     mCTFCoder.createCoders(dictPath, o2::ctf::CTFCoderBase::OpType::Encoder);
   }
+  mCTFCoder.setANSNStreams(ic.options().get<int>("ans-streams"));
 }
 
 void EntropyEncoderSpec::run(ProcessingContext& pc)
@@ -72,7 +73,8 @@ DataProcessorSpec getEntropyEncoderSpec()
     inputs,
     Outputs{{"FDD", "CTFDATA", 0, Lifetime::Timeframe}},
     AlgorithmSpec{adaptFromTask<EntropyEncoderSpec>()},
-    Options{{"ctf-dict", VariantType::String, o2::base::NameConf::getCTFDictFileName(), {"File of CTF encoding dictionary"}}}};
+    Options{{"ctf-dict", VariantType::String, o2::base::NameConf::getCTFDictFileName(), {"File of CTF encoding dictionary"}},
+            {"ans-streams", VariantType::Int, 0, {"Number of interleaved rANS streams (1, 2, 4, 8 or 16), 0 for the default format"}}}};
 }
 
 } // namespace fdd
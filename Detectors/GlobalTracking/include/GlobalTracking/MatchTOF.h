@@ -94,6 +94,13 @@ class MatchTOF
 
   void setHighPurity(bool value = true) { mSetHighPurity = value; }
 
+  ///< set the material correction used in the propagation of the tracks to TOF
+  void setUseMatCorrFlag(o2::base::Propagator::MatCorrType f) { mUseMatCorrFlag = f; }
+
+  ///< set number of threads for the matching (sectors and track types are processed in parallel)
+  void setNThreads(int n) { mNThreads = n > 0 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
+
   ///< print settings
   void print() const;
   void printCandidatesTOF() const;
@@ -231,6 +238,8 @@ class MatchTOF
   bool mIsTPCTRDused = false;
   bool mIsITSTPCTRDused = false;
   bool mSetHighPurity = false;
+  int mNThreads = 1; ///< number of threads for matching
+  o2::base::Propagator::MatCorrType mUseMatCorrFlag = o2::base::Propagator::MatCorrType::USEMatCorrLUT; ///< material correction for the propagation
 
   // from ruben
   gsl::span<const o2::tpc::TrackTPC> mTPCTracksArray; ///< input TPC tracks span
@@ -272,6 +281,8 @@ class MatchTOF
 
   ///<array of track-TOFCluster pairs from the matching
   std::vector<o2::dataformats::MatchInfoTOFReco> mMatchedTracksPairs;
+  ///< per sector track-TOFCluster pairs found for every track type, merged to mMatchedTracksPairs before the selection
+  std::array<std::vector<o2::dataformats::MatchInfoTOFReco>, o2::constants::math::NSectors> mMatchedTracksPairsSec[trkType::SIZE];
 
   ///<array of TOFChannel calibration info
   std::vector<o2::dataformats::CalibInfoTOF> mCalibInfoTOF;
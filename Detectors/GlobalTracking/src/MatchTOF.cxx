@@ -10,6 +10,7 @@
 // or submit itself to any jurisdiction.
 #include <TTree.h>
 #include <cassert>
+#include <chrono>
 
 #include "FairLogger.h"
 #include "Field/MagneticField.h"
@@ -108,20 +109,67 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp)
   LOGF(INFO, "Timing prepare FIT data: Cpu: %.3e s Real: %.3e s in %d slots", mTimerTot.CpuTime(), mTimerTot.RealTime(), mTimerTot.Counter() - 1);
 
   mTimerTot.Start();
+  for (int it = 0; it < trkType::SIZE; it++) {
+    for (int sec = o2::constants::math::NSectors; sec--;) {
+      mMatchedTracksPairsSec[it][sec].clear();
+    }
+  }
+  bool matchConstrained = mIsITSTPCused || mIsTPCTRDused || mIsITSTPCTRDused;
+  bool matchedInParallel = false;
+#ifdef WITH_OPENMP
+  // the propagation in the full field map or with TGeo material queries cannot run concurrently
+  bool canMatchInParallel = o2::base::Propagator::Instance()->isThreadSafe(mUseMatCorrFlag);
+  if (mNThreads > 1 && !canMatchInParallel) {
+    LOG(WARNING) << "The propagator is not thread-safe with the current field and material settings, matching sequentially";
+  }
+  if (mNThreads > 1 && canMatchInParallel) {
+    // tracks and clusters of different sectors are independent, the candidate pairs of every sector and track type
+    // are collected separately and the best matches are selected sequentially in the same order as without threads
+    Geo::Init(); // lazy initialization of the geometry is not thread-safe
+    int nTasks = o2::constants::math::NSectors * trkType::SIZE;
+    std::vector<double> taskTime(nTasks, 0.); // real time of every task, the stopwatches cannot be shared by the threads
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+    for (int itask = 0; itask < nTasks; itask++) {
+      int sec = itask / trkType::SIZE, type = itask % trkType::SIZE;
+      auto start = std::chrono::steady_clock::now();
+      if (type == trkType::CONSTR && matchConstrained) {
+        doMatching(sec);
+      } else if (type == trkType::UNCONS && mIsTPCused) {
+        doMatchingForTPC(sec);
+      }
+      taskTime[itask] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    matchedInParallel = true;
+    for (int type : {trkType::CONSTR, trkType::UNCONS}) {
+      double sumTime = 0.;
+      for (int sec = 0; sec < o2::constants::math::NSectors; sec++) {
+        sumTime += taskTime[sec * trkType::SIZE + type];
+      }
+      LOGF(INFO, "Timing Do Matching %s: Real: %.3e s summed over the sectors matched in %d threads", type == trkType::CONSTR ? "ITSTPC" : "TPC   ", sumTime, mNThreads);
+    }
+  }
+#endif
   for (int sec = o2::constants::math::NSectors; sec--;) {
-    mMatchedTracksPairs.clear(); // new sector
-    LOG(INFO) << "Doing matching for sector " << sec << "...";
-    if (mIsITSTPCused || mIsTPCTRDused || mIsITSTPCTRDused) {
-      mTimerMatchITSTPC.Start(sec == o2::constants::math::NSectors - 1);
-      doMatching(sec);
-      mTimerMatchITSTPC.Stop();
+    if (!matchedInParallel) {
+      LOG(INFO) << "Doing matching for sector " << sec << "...";
+      if (matchConstrained) {
+        mTimerMatchITSTPC.Start(sec == o2::constants::math::NSectors - 1);
+        doMatching(sec);
+        mTimerMatchITSTPC.Stop();
+      }
+      if (mIsTPCused) {
+        mTimerMatchTPC.Start(sec == o2::constants::math::NSectors - 1);
+        doMatchingForTPC(sec);
+        mTimerMatchTPC.Stop();
+      }
+      LOG(INFO) << "...done. Now check the best matches";
     }
-    if (mIsTPCused) {
-      mTimerMatchTPC.Start(sec == o2::constants::math::NSectors - 1);
-      doMatchingForTPC(sec);
-      mTimerMatchTPC.Stop();
+    mMatchedTracksPairs.clear(); // new sector
+    for (int type : {trkType::CONSTR, trkType::UNCONS}) {
+      auto& pairsSec = mMatchedTracksPairsSec[type][sec];
+      mMatchedTracksPairs.insert(mMatchedTracksPairs.end(), pairsSec.begin(), pairsSec.end());
+      pairsSec.clear();
     }
-    LOG(INFO) << "...done. Now check the best matches";
     selectBestMatches();
   }
 
@@ -135,8 +183,10 @@ void MatchTOF::run(const o2::globaltracking::RecoContainer& inp)
 
   mTimerTot.Stop();
   LOGF(INFO, "Timing Do Matching:        Cpu: %.3e s Real: %.3e s in %d slots", mTimerTot.CpuTime(), mTimerTot.RealTime(), mTimerTot.Counter() - 1);
-  LOGF(INFO, "Timing Do Matching ITSTPC: Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchITSTPC.CpuTime(), mTimerMatchITSTPC.RealTime(), mTimerMatchITSTPC.Counter() - 1);
-  LOGF(INFO, "Timing Do Matching TPC   : Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchTPC.CpuTime(), mTimerMatchTPC.RealTime(), mTimerMatchTPC.Counter() - 1);
+  if (!matchedInParallel) {
+    LOGF(INFO, "Timing Do Matching ITSTPC: Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchITSTPC.CpuTime(), mTimerMatchITSTPC.RealTime(), mTimerMatchITSTPC.Counter() - 1);
+    LOGF(INFO, "Timing Do Matching TPC   : Cpu: %.3e s Real: %.3e s in %d slots", mTimerMatchTPC.CpuTime(), mTimerMatchTPC.RealTime(), mTimerMatchTPC.Counter() - 1);
+  }
 }
 //______________________________________________
 void MatchTOF::print() const
@@ -644,7 +694,7 @@ void MatchTOF::doMatching(int sec)
           foundCluster = true;
           // set event indexes (to be checked)
           int eventIndexTOFCluster = mTOFClusSectIndexCache[indices[0]][itof];
-          mMatchedTracksPairs.emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[iPropagation], mTrackGid[type][cacheTrk[itrk]], type); // TODO: check if this is correct!
+          mMatchedTracksPairsSec[type][sec].emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[iPropagation], mTrackGid[type][cacheTrk[itrk]], type); // TODO: check if this is correct!
         }
       }
     }
@@ -972,7 +1022,7 @@ void MatchTOF::doMatchingForTPC(int sec)
             foundCluster = true;
             // set event indexes (to be checked)
             int eventIndexTOFCluster = mTOFClusSectIndexCache[indices[0]][itof];
-            mMatchedTracksPairs.emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[ibc][iPropagation], mTrackGid[trkType::UNCONS][cacheTrk[itrk]], trkType::UNCONS, resZ / vdrift * side, trefTOF.getZ()); // TODO: check if this is correct!
+            mMatchedTracksPairsSec[trkType::UNCONS][sec].emplace_back(cacheTrk[itrk], eventIndexTOFCluster, mTOFClusWork[cacheTOF[itof]].getTime(), chi2, trkLTInt[ibc][iPropagation], mTrackGid[trkType::UNCONS][cacheTrk[itrk]], trkType::UNCONS, resZ / vdrift * side, trefTOF.getZ()); // TODO: check if this is correct!
           }
         }
       }
@@ -1165,7 +1215,7 @@ void MatchTOF::selectBestMatchesHP()
 bool MatchTOF::propagateToRefX(o2::track::TrackParCov& trc, float xRef, float stepInCm, o2::track::TrackLTIntegral& intLT)
 {
   // propagate track to matching reference X
-  o2::base::Propagator::MatCorrType matCorr = o2::base::Propagator::MatCorrType::USEMatCorrLUT; // material correction method
+  o2::base::Propagator::MatCorrType matCorr = mUseMatCorrFlag; // material correction method
   static const float tanHalfSector = tan(o2::constants::math::SectorSpanRad / 2);
   bool refReached = false;
   float xStart = trc.getX();
@@ -0,0 +1,122 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#define BOOST_TEST_MODULE Test MatchTOF threads
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "GlobalTracking/MatchTOF.h"
+#include "DataFormatsGlobalTracking/RecoContainer.h"
+#include "DataFormatsTPC/TrackTPC.h"
+#include "DataFormatsTOF/Cluster.h"
+#include "DetectorsBase/Propagator.h"
+#include "TOFBase/Geo.h"
+#include "TPCBase/ParameterElectronics.h"
+#include "GPUTPCGMPolynomialField.h"
+#include "GPUTPCGMPolynomialFieldManager.h"
+#include "MathUtils/Utils.h"
+#include <TRandom3.h>
+#include <vector>
+
+namespace o2
+{
+namespace globaltracking
+{
+
+using MatCorrType = o2::base::Propagator::MatCorrType;
+using trkType = o2::dataformats::MatchInfoTOFReco::TrackType;
+
+// TPC tracks with, for most of them, a TOF cluster in the pad they cross, all with overlapping time windows
+void generateEvent(std::vector<o2::tpc::TrackTPC>& tracks, std::vector<o2::tof::Cluster>& clusters)
+{
+  auto prop = o2::base::Propagator::Instance();
+  float zbinWidth = o2::tpc::ParameterElectronics::Instance().ZbinWidth;
+  TRandom3 rnd(1234);
+  std::array<float, 15> cov = {1e-2, 0, 1e-2, 0, 0, 1e-4, 0, 0, 0, 1e-4, 0, 0, 0, 0, 1e-3};
+  for (int i = 0; i < 500; i++) {
+    float alpha = o2::math_utils::sector2Angle(rnd.Integer(o2::constants::math::NSectors));
+    std::array<float, 5> par = {float(rnd.Uniform(-20, 20)), float(rnd.Uniform(-100, 100)), float(rnd.Uniform(-0.1, 0.1)),
+                                float(rnd.Uniform(-0.3, 0.3)), float((rnd.Rndm() > 0.5 ? 1 : -1) * rnd.Uniform(0.1, 1))};
+    o2::track::TrackParCov outer(250.f, alpha, par, cov);
+    auto& track = tracks.emplace_back();
+    track.o2::track::TrackParCov::operator=(outer);
+    track.setOuterParam(std::move(outer));
+    track.setTime0(1000.f + 10.f * i);
+    track.setDeltaTBwd(20.f);
+    track.setDeltaTFwd(20.f);
+
+    // the cluster is put in the first pad crossed by the track, which is what the matching finds
+    auto trc = track.getOuterParam();
+    int det[5] = {-1, -1, -1, -1, -1};
+    float dpos[3];
+    for (float x = 371.f; x < o2::tof::Geo::RMAX && prop->PropagateToXBxByBz(trc, x, o2::base::Propagator::MAX_SIN_PHI, 1.f, MatCorrType::USEMatCorrNONE); x += 1.f) {
+      std::array<float, 3> pos;
+      trc.getXYZGlo(pos);
+      o2::tof::Geo::getPadDxDyDz(pos.data(), det, dpos);
+      if (det[2] != -1) {
+        break;
+      }
+    }
+    if (det[2] == -1) {
+      continue;
+    }
+    auto& cluster = clusters.emplace_back();
+    cluster.setMainContributingChannel(o2::tof::Geo::getIndex(det));
+    double time = track.getTime0() * zbinWidth * 1e6 + 12000; // in ps, with about the time of flight of a pion
+    cluster.setTime(time);
+    cluster.setTimeRaw(time);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MatchTOFSameWithThreads)
+{
+  // the polynomial field can be used concurrently, no material is needed, thus neither the geometry nor the field map
+  auto prop = o2::base::Propagator::Instance(true);
+  prop->setBz(5.f);
+  static o2::gpu::GPUTPCGMPolynomialField field;
+  o2::gpu::GPUTPCGMPolynomialFieldManager::GetPolynomialField(5.f, field);
+  prop->setGPUField(&field);
+  BOOST_REQUIRE(prop->isThreadSafe(MatCorrType::USEMatCorrNONE));
+  o2::tof::Geo::Init();
+
+  std::vector<o2::tpc::TrackTPC> tracks;
+  std::vector<o2::tof::Cluster> clusters;
+  generateEvent(tracks, clusters);
+  BOOST_REQUIRE(clusters.size() > 0);
+
+  RecoContainer inp;
+  inp.commonPool[RecoContainer::GTrackID::TPC].registerContainer(tracks, RecoContainer::TRACKS);
+  inp.commonPool[RecoContainer::GTrackID::TOF].registerContainer(clusters, RecoContainer::CLUSTERS);
+
+  auto match = [&inp](int nThreads) {
+    MatchTOF matching;
+    matching.setUseMatCorrFlag(MatCorrType::USEMatCorrNONE);
+    matching.setNThreads(nThreads);
+    matching.run(inp);
+    return matching.getMatchedTrackVector(trkType::UNCONS);
+  };
+  auto reference = match(1);
+  BOOST_CHECK(reference.size() > 0);
+  for (int nThreads : {2, 4}) {
+    auto matches = match(nThreads);
+    BOOST_REQUIRE_EQUAL(matches.size(), reference.size());
+    for (size_t i = 0; i < matches.size(); i++) {
+      BOOST_CHECK_EQUAL(matches[i].getTOFClIndex(), reference[i].getTOFClIndex());
+      BOOST_CHECK_EQUAL(matches[i].getTrackRef().getIndex(), reference[i].getTrackRef().getIndex());
+      BOOST_CHECK_EQUAL(matches[i].getChi2(), reference[i].getChi2());
+      BOOST_CHECK_EQUAL(matches[i].getLTIntegralOut().getL(), reference[i].getLTIntegralOut().getL());
+    }
+  }
+}
+
+} // namespace globaltracking
+} // namespace o2
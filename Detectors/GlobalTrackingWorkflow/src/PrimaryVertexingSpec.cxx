@@ -89,6 +89,7 @@ void PrimaryVertexingSpec::init(InitContext& ic)
   mTimer.Stop();
   mTimer.Reset();
   mVertexer.setValidateWithIR(mValidateWithIR);
+  mVertexer.setNThreads(ic.options().get<int>("nthreads"));
 
   // set bunch filling. Eventually, this should come from CCDB
   const auto* digctx = o2::steer::DigitizationContext::loadFromFile();
@@ -200,7 +201,8 @@ DataProcessorSpec getPrimaryVertexingSpec(GTrackID::mask_t src, bool validateWit
     dataRequest->inputs,
     outputs,
     AlgorithmSpec{adaptFromTask<PrimaryVertexingSpec>(dataRequest, validateWithFT0, useMC)},
-    Options{{"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}}}};
+    Options{{"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads"}}}};
 }
 
 } // namespace vertexing
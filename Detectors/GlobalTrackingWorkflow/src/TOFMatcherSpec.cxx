@@ -93,6 +93,7 @@ void TOFMatcherSpec::init(InitContext& ic)
   if (mStrict) {
     mMatcher.setHighPurity();
   }
+  mMatcher.setNThreads(ic.options().get<int>("nthreads"));
 }
 
 void TOFMatcherSpec::run(ProcessingContext& pc)
@@ -198,7 +199,8 @@ DataProcessorSpec getTOFMatcherSpec(GID::mask_t src, bool useMC, bool useFIT, bo
     outputs,
     AlgorithmSpec{adaptFromTask<TOFMatcherSpec>(dataRequest, useMC, useFIT, tpcRefit, strict)},
     Options{
-      {"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}}}};
+      {"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}},
+      {"nthreads", VariantType::Int, 1, {"Number of threads"}}}};
 }
 
 } // namespace globaltracking
@@ -72,6 +72,8 @@ class Tracker
   void clustersToTracks(std::function<void(std::string s)> = [](std::string s) { std::cout << s << std::endl; });
   void setSmoothing(bool v) { mApplySmoothing = v; }
   bool getSmoothing() const { return mApplySmoothing; }
+  void setNThreads(int n);
+  int getNThreads() const { return mNThreads; }
 
   std::vector<TrackITSExt>& getTracks();
 
@@ -111,6 +113,7 @@ class Tracker
   bool mApplySmoothing = false;
   o2::base::PropagatorImpl<float>::MatCorrType mCorrType = o2::base::PropagatorImpl<float>::MatCorrType::USEMatCorrLUT;
   float mBz = 5.f;
+  int mNThreads = 1;
   std::uint32_t mROFrame = 0;
   o2::gpu::GPUChainITS* mRecoChain = nullptr;
 
@@ -135,6 +138,12 @@ inline void Tracker::setBz(float bz)
   mBz = bz;
 }
 
+inline void Tracker::setNThreads(int n)
+{
+  mNThreads = n > 0 ? n : 1;
+  mTraits->setNThreads(mNThreads);
+}
+
 template <typename... T>
 void Tracker::initialiseTimeFrame(T&&... args)
 {
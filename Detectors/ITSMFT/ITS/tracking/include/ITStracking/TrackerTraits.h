@@ -65,9 +65,13 @@ class TrackerTraits
   void UpdateTrackingParameters(const TrackingParameters& trkPar);
   TimeFrame* getTimeFrame() { return mTimeFrame; }
 
+  void setNThreads(int n) { mNThreads = n > 0 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
+
  protected:
   TimeFrame* mTimeFrame;
   TrackingParameters mTrkParams;
+  int mNThreads = 1;
 
   o2::gpu::GPUChainITS* mChain = nullptr;
   FuncRunITSTrackFit_t mChainRunITSTrackFit;
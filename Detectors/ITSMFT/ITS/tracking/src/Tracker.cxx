@@ -32,6 +32,10 @@
 #include <string>
 #include <climits>
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2
 {
 namespace its
@@ -212,100 +216,120 @@ void Tracker::findRoads(int& iteration)
 
 void Tracker::findTracks()
 {
-  std::vector<TrackITSExt> tracks;
-  tracks.reserve(mTimeFrame->getRoads().size());
-
-  for (auto& road : mTimeFrame->getRoads()) {
-    std::vector<int> clusters(mTrkParams[0].NLayers, constants::its::UnusedIndex);
-    int lastCellLevel = constants::its::UnusedIndex;
-    CA_DEBUGGER(int nClusters = 2);
-    int firstTracklet{constants::its::UnusedIndex};
-    std::vector<int> tracklets(mTrkParams[0].TrackletsPerRoad(), constants::its::UnusedIndex);
-
-    for (int iCell{0}; iCell < mTrkParams[0].CellsPerRoad(); ++iCell) {
-      const int cellIndex = road[iCell];
-      if (cellIndex == constants::its::UnusedIndex) {
-        continue;
-      } else {
-        if (firstTracklet == constants::its::UnusedIndex) {
-          firstTracklet = iCell;
+  // roads are fitted concurrently in contiguous chunks, the tracks are merged in the road order to keep the output deterministic.
+  // TGeo material queries are not thread-safe, in this case the fit stays sequential
+  auto& roads = mTimeFrame->getRoads();
+  const int nThreads{mCorrType == o2::base::PropagatorImpl<float>::MatCorrType::USEMatCorrTGeo ? 1 : mNThreads};
+  const int nRoads{static_cast<int>(roads.size())};
+  const int nChunks{std::min(nRoads, 4 * nThreads)};
+  std::vector<std::vector<TrackITSExt>> tracksTmp(nChunks);
+#ifdef WITH_OPENMP
+  omp_set_num_threads(nThreads);
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (int iChunk = 0; iChunk < nChunks; ++iChunk) {
+    auto& tracks = tracksTmp[iChunk];
+    const int firstRoad{static_cast<int>(static_cast<long>(nRoads) * iChunk / nChunks)};
+    const int lastRoad{static_cast<int>(static_cast<long>(nRoads) * (iChunk + 1) / nChunks)};
+    for (int iRoad{firstRoad}; iRoad < lastRoad; ++iRoad) {
+      auto& road = roads[iRoad];
+      std::vector<int> clusters(mTrkParams[0].NLayers, constants::its::UnusedIndex);
+      int lastCellLevel = constants::its::UnusedIndex;
+      CA_DEBUGGER(int nClusters = 2);
+      int firstTracklet{constants::its::UnusedIndex};
+      std::vector<int> tracklets(mTrkParams[0].TrackletsPerRoad(), constants::its::UnusedIndex);
+
+      for (int iCell{0}; iCell < mTrkParams[0].CellsPerRoad(); ++iCell) {
+        const int cellIndex = road[iCell];
+        if (cellIndex == constants::its::UnusedIndex) {
+          continue;
+        } else {
+          if (firstTracklet == constants::its::UnusedIndex) {
+            firstTracklet = iCell;
+          }
+          tracklets[iCell] = mTimeFrame->getCells()[iCell][cellIndex].getFirstTrackletIndex();
+          tracklets[iCell + 1] = mTimeFrame->getCells()[iCell][cellIndex].getSecondTrackletIndex();
+          clusters[iCell] = mTimeFrame->getCells()[iCell][cellIndex].getFirstClusterIndex();
+          clusters[iCell + 1] = mTimeFrame->getCells()[iCell][cellIndex].getSecondClusterIndex();
+          clusters[iCell + 2] = mTimeFrame->getCells()[iCell][cellIndex].getThirdClusterIndex();
+          assert(clusters[iCell] != constants::its::UnusedIndex &&
+                 clusters[iCell + 1] != constants::its::UnusedIndex &&
+                 clusters[iCell + 2] != constants::its::UnusedIndex);
+          lastCellLevel = iCell;
+          CA_DEBUGGER(nClusters++);
         }
-        tracklets[iCell] = mTimeFrame->getCells()[iCell][cellIndex].getFirstTrackletIndex();
-        tracklets[iCell + 1] = mTimeFrame->getCells()[iCell][cellIndex].getSecondTrackletIndex();
-        clusters[iCell] = mTimeFrame->getCells()[iCell][cellIndex].getFirstClusterIndex();
-        clusters[iCell + 1] = mTimeFrame->getCells()[iCell][cellIndex].getSecondClusterIndex();
-        clusters[iCell + 2] = mTimeFrame->getCells()[iCell][cellIndex].getThirdClusterIndex();
-        assert(clusters[iCell] != constants::its::UnusedIndex &&
-               clusters[iCell + 1] != constants::its::UnusedIndex &&
-               clusters[iCell + 2] != constants::its::UnusedIndex);
-        lastCellLevel = iCell;
-        CA_DEBUGGER(nClusters++);
       }
-    }
 
-    CA_DEBUGGER(assert(nClusters >= mTrkParams[0].MinTrackLength));
-    int count{1};
-    unsigned short rof{mTimeFrame->getTracklets()[firstTracklet][tracklets[firstTracklet]].rof[0]};
-    for (int iT = firstTracklet; iT < 6; ++iT) {
-      if (tracklets[iT] == constants::its::UnusedIndex) {
-        continue;
-      }
-      if (rof == mTimeFrame->getTracklets()[iT][tracklets[iT]].rof[1]) {
-        count++;
-      } else {
-        if (count == 1) {
-          rof = mTimeFrame->getTracklets()[iT][tracklets[iT]].rof[1];
+      CA_DEBUGGER(assert(nClusters >= mTrkParams[0].MinTrackLength));
+      int count{1};
+      unsigned short rof{mTimeFrame->getTracklets()[firstTracklet][tracklets[firstTracklet]].rof[0]};
+      for (int iT = firstTracklet; iT < 6; ++iT) {
+        if (tracklets[iT] == constants::its::UnusedIndex) {
+          continue;
+        }
+        if (rof == mTimeFrame->getTracklets()[iT][tracklets[iT]].rof[1]) {
+          count++;
         } else {
-          count--;
+          if (count == 1) {
+            rof = mTimeFrame->getTracklets()[iT][tracklets[iT]].rof[1];
+          } else {
+            count--;
+          }
         }
       }
-    }
 
-    CA_DEBUGGER(assert(nClusters >= mTrkParams[0].MinTrackLength));
-    CA_DEBUGGER(roadCounters[nClusters - 4]++);
+      CA_DEBUGGER(assert(nClusters >= mTrkParams[0].MinTrackLength));
+      CA_DEBUGGER(roadCounters[nClusters - 4]++);
 
-    if (lastCellLevel == constants::its::UnusedIndex) {
-      continue;
-    }
+      if (lastCellLevel == constants::its::UnusedIndex) {
+        continue;
+      }
 
-    /// From primary vertex context index to event index (== the one used as input of the tracking code)
-    for (int iC{0}; iC < clusters.size(); iC++) {
-      if (clusters[iC] != constants::its::UnusedIndex) {
-        clusters[iC] = mTimeFrame->getClusters()[iC][clusters[iC]].clusterId;
+      /// From primary vertex context index to event index (== the one used as input of the tracking code)
+      for (int iC{0}; iC < clusters.size(); iC++) {
+        if (clusters[iC] != constants::its::UnusedIndex) {
+          clusters[iC] = mTimeFrame->getClusters()[iC][clusters[iC]].clusterId;
+        }
       }
-    }
 
-    /// Track seed preparation. Clusters are numbered progressively from the outermost to the innermost.
-    const auto& cluster1_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel + 2].at(clusters[lastCellLevel + 2]);
-    const auto& cluster2_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel + 1].at(clusters[lastCellLevel + 1]);
-    const auto& cluster3_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel].at(clusters[lastCellLevel]);
+      /// Track seed preparation. Clusters are numbered progressively from the outermost to the innermost.
+      const auto& cluster1_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel + 2].at(clusters[lastCellLevel + 2]);
+      const auto& cluster2_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel + 1].at(clusters[lastCellLevel + 1]);
+      const auto& cluster3_glo = mTimeFrame->getUnsortedClusters()[lastCellLevel].at(clusters[lastCellLevel]);
 
-    const auto& cluster3_tf = mTimeFrame->getTrackingFrameInfoOnLayer(lastCellLevel).at(clusters[lastCellLevel]);
+      const auto& cluster3_tf = mTimeFrame->getTrackingFrameInfoOnLayer(lastCellLevel).at(clusters[lastCellLevel]);
 
-    /// FIXME!
-    TrackITSExt temporaryTrack{buildTrackSeed(cluster1_glo, cluster2_glo, cluster3_glo, cluster3_tf)};
-    for (size_t iC = 0; iC < clusters.size(); ++iC) {
-      temporaryTrack.setExternalClusterIndex(iC, clusters[iC], clusters[iC] != constants::its::UnusedIndex);
-    }
-    bool fitSuccess = fitTrack(temporaryTrack, mTrkParams[0].NLayers - 4, -1, -1);
-    if (!fitSuccess) {
-      continue;
-    }
-    CA_DEBUGGER(fitCounters[nClusters - 4]++);
-    temporaryTrack.resetCovariance();
-    fitSuccess = fitTrack(temporaryTrack, 0, mTrkParams[0].NLayers, 1, mTrkParams[0].FitIterationMaxChi2[0]);
-    if (!fitSuccess) {
-      continue;
-    }
-    CA_DEBUGGER(backpropagatedCounters[nClusters - 4]++);
-    temporaryTrack.getParamOut() = temporaryTrack;
-    temporaryTrack.resetCovariance();
-    fitSuccess = fitTrack(temporaryTrack, mTrkParams[0].NLayers - 1, -1, -1, mTrkParams[0].FitIterationMaxChi2[1], 50.);
-    if (!fitSuccess) {
-      continue;
+      /// FIXME!
+      TrackITSExt temporaryTrack{buildTrackSeed(cluster1_glo, cluster2_glo, cluster3_glo, cluster3_tf)};
+      for (size_t iC = 0; iC < clusters.size(); ++iC) {
+        temporaryTrack.setExternalClusterIndex(iC, clusters[iC], clusters[iC] != constants::its::UnusedIndex);
+      }
+      bool fitSuccess = fitTrack(temporaryTrack, mTrkParams[0].NLayers - 4, -1, -1);
+      if (!fitSuccess) {
+        continue;
+      }
+      CA_DEBUGGER(fitCounters[nClusters - 4]++);
+      temporaryTrack.resetCovariance();
+      fitSuccess = fitTrack(temporaryTrack, 0, mTrkParams[0].NLayers, 1, mTrkParams[0].FitIterationMaxChi2[0]);
+      if (!fitSuccess) {
+        continue;
+      }
+      CA_DEBUGGER(backpropagatedCounters[nClusters - 4]++);
+      temporaryTrack.getParamOut() = temporaryTrack;
+      temporaryTrack.resetCovariance();
+      fitSuccess = fitTrack(temporaryTrack, mTrkParams[0].NLayers - 1, -1, -1, mTrkParams[0].FitIterationMaxChi2[1], 50.);
+      if (!fitSuccess) {
+        continue;
+      }
+      // temporaryTrack.setROFrame(rof);
+      tracks.emplace_back(temporaryTrack);
     }
-    // temporaryTrack.setROFrame(rof);
-    tracks.emplace_back(temporaryTrack);
+  }
+
+  std::vector<TrackITSExt> tracks;
+  tracks.reserve(nRoads);
+  for (auto& chunkTracks : tracksTmp) {
+    tracks.insert(tracks.end(), chunkTracks.begin(), chunkTracks.end());
   }
 
   if (mApplySmoothing) {
@@ -27,6 +27,10 @@
 
 #include "GPUCommonMath.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2
 {
 namespace its
@@ -38,90 +42,104 @@ void TrackerTraitsCPU::computeLayerTracklets()
 {
   TimeFrame* tf = mTimeFrame;
 
-  for (int rof0{0}; rof0 < tf->getNrof(); ++rof0) {
+  // every (ROF, layer) pair is an independent task, each thread collects its tracklets separately. Since the merged tracklets
+  // are sorted below, the output does not depend on the number of threads. The lookup table entries of different tasks are disjoint.
+  const int nLayers{mTrkParams.TrackletsPerRoad()};
+  const int nTasks{tf->getNrof() * nLayers};
+  std::vector<std::vector<std::vector<Tracklet>>> trackletsTmp(mNThreads, std::vector<std::vector<Tracklet>>(nLayers));
+#ifdef WITH_OPENMP
+  omp_set_num_threads(mNThreads);
+  int dynGrp = std::min(4, std::max(1, mNThreads / 2));
+#pragma omp parallel for schedule(dynamic, dynGrp)
+#endif
+  for (int iTask = 0; iTask < nTasks; ++iTask) {
+    const int rof0{iTask / nLayers}, iLayer{iTask % nLayers};
+    int iThread{0};
+#ifdef WITH_OPENMP
+    iThread = omp_get_thread_num();
+#endif
+    auto& tracklets = trackletsTmp[iThread][iLayer];
     gsl::span<const Vertex> primaryVertices = tf->getPrimaryVertices(rof0);
     int minRof = (rof0 >= mTrkParams.DeltaROF) ? rof0 - mTrkParams.DeltaROF : 0;
     int maxRof = (rof0 == tf->getNrof() - mTrkParams.DeltaROF) ? rof0 : rof0 + mTrkParams.DeltaROF;
-    for (int iLayer{0}; iLayer < mTrkParams.TrackletsPerRoad(); ++iLayer) {
-      gsl::span<const Cluster> layer0 = tf->getClustersOnLayer(rof0, iLayer);
-      if (layer0.empty()) {
+    gsl::span<const Cluster> layer0 = tf->getClustersOnLayer(rof0, iLayer);
+    if (layer0.empty()) {
+      continue;
+    }
+
+    const int currentLayerClustersNum{static_cast<int>(layer0.size())};
+    for (int iCluster{0}; iCluster < currentLayerClustersNum; ++iCluster) {
+      const Cluster& currentCluster{layer0[iCluster]};
+      const int currentSortedIndex{tf->getSortedIndex(rof0, iLayer, iCluster)};
+
+      if (tf->isClusterUsed(iLayer, currentCluster.clusterId)) {
         continue;
       }
 
-      const int currentLayerClustersNum{static_cast<int>(layer0.size())};
-      for (int iCluster{0}; iCluster < currentLayerClustersNum; ++iCluster) {
-        const Cluster& currentCluster{layer0[iCluster]};
-        const int currentSortedIndex{tf->getSortedIndex(rof0, iLayer, iCluster)};
+      for (auto& primaryVertex : primaryVertices) {
+        const float tanLambda{(currentCluster.zCoordinate - primaryVertex.getZ()) / currentCluster.radius};
+
+        const float zAtRmin{tanLambda * (tf->getMinR(iLayer + 1) - currentCluster.radius) + currentCluster.zCoordinate};
+        const float zAtRmax{tanLambda * (tf->getMaxR(iLayer + 1) - currentCluster.radius) + currentCluster.zCoordinate};
+
+        const int4 selectedBinsRect{getBinsRect(currentCluster, iLayer, zAtRmin, zAtRmax,
+                                                mTrkParams.TrackletMaxDeltaZ[iLayer], mTrkParams.TrackletMaxDeltaPhi)};
 
-        if (tf->isClusterUsed(iLayer, currentCluster.clusterId)) {
+        if (selectedBinsRect.x == 0 && selectedBinsRect.y == 0 && selectedBinsRect.z == 0 && selectedBinsRect.w == 0) {
           continue;
         }
 
-        for (auto& primaryVertex : primaryVertices) {
-          const float tanLambda{(currentCluster.zCoordinate - primaryVertex.getZ()) / currentCluster.radius};
+        int phiBinsNum{selectedBinsRect.w - selectedBinsRect.y + 1};
 
-          const float zAtRmin{tanLambda * (tf->getMinR(iLayer + 1) - currentCluster.radius) + currentCluster.zCoordinate};
-          const float zAtRmax{tanLambda * (tf->getMaxR(iLayer + 1) - currentCluster.radius) + currentCluster.zCoordinate};
-
-          const int4 selectedBinsRect{getBinsRect(currentCluster, iLayer, zAtRmin, zAtRmax,
-                                                  mTrkParams.TrackletMaxDeltaZ[iLayer], mTrkParams.TrackletMaxDeltaPhi)};
+        if (phiBinsNum < 0) {
+          phiBinsNum += mTrkParams.PhiBins;
+        }
 
-          if (selectedBinsRect.x == 0 && selectedBinsRect.y == 0 && selectedBinsRect.z == 0 && selectedBinsRect.w == 0) {
+        for (int rof1{minRof}; rof1 <= maxRof; ++rof1) {
+          gsl::span<const Cluster> layer1 = tf->getClustersOnLayer(rof1, iLayer + 1);
+          if (layer1.empty()) {
             continue;
           }
 
-          int phiBinsNum{selectedBinsRect.w - selectedBinsRect.y + 1};
-
-          if (phiBinsNum < 0) {
-            phiBinsNum += mTrkParams.PhiBins;
-          }
-
-          for (int rof1{minRof}; rof1 <= maxRof; ++rof1) {
-            gsl::span<const Cluster> layer1 = tf->getClustersOnLayer(rof1, iLayer + 1);
-            if (layer1.empty()) {
-              continue;
+          for (int iPhiCount{0}; iPhiCount < phiBinsNum; iPhiCount++) {
+            int iPhiBin = (selectedBinsRect.y + iPhiCount) % mTrkParams.PhiBins;
+            const int firstBinIndex{tf->mIndexTableUtils.getBinIndex(selectedBinsRect.x, iPhiBin)};
+            const int maxBinIndex{firstBinIndex + selectedBinsRect.z - selectedBinsRect.x + 1};
+            if constexpr (debugLevel) {
+              if (firstBinIndex < 0 || firstBinIndex > tf->getIndexTables(rof1)[iLayer].size() ||
+                  maxBinIndex < 0 || maxBinIndex > tf->getIndexTables(rof1)[iLayer].size()) {
+                std::cout << iLayer << "\t" << iCluster << "\t" << zAtRmin << "\t" << zAtRmax << "\t" << mTrkParams.TrackletMaxDeltaZ[iLayer] << "\t" << mTrkParams.TrackletMaxDeltaPhi << std::endl;
+                std::cout << currentCluster.zCoordinate << "\t" << primaryVertex.getZ() << "\t" << currentCluster.radius << std::endl;
+                std::cout << tf->getMinR(iLayer + 1) << "\t" << currentCluster.radius << "\t" << currentCluster.zCoordinate << std::endl;
+                std::cout << "Illegal access to IndexTable " << firstBinIndex << "\t" << maxBinIndex << "\t" << selectedBinsRect.z << "\t" << selectedBinsRect.x << std::endl;
+                exit(1);
+              }
             }
+            const int firstRowClusterIndex = tf->getIndexTables(rof1)[iLayer][firstBinIndex];
+            const int maxRowClusterIndex = tf->getIndexTables(rof1)[iLayer][maxBinIndex];
 
-            for (int iPhiCount{0}; iPhiCount < phiBinsNum; iPhiCount++) {
-              int iPhiBin = (selectedBinsRect.y + iPhiCount) % mTrkParams.PhiBins;
-              const int firstBinIndex{tf->mIndexTableUtils.getBinIndex(selectedBinsRect.x, iPhiBin)};
-              const int maxBinIndex{firstBinIndex + selectedBinsRect.z - selectedBinsRect.x + 1};
-              if constexpr (debugLevel) {
-                if (firstBinIndex < 0 || firstBinIndex > tf->getIndexTables(rof1)[iLayer].size() ||
-                    maxBinIndex < 0 || maxBinIndex > tf->getIndexTables(rof1)[iLayer].size()) {
-                  std::cout << iLayer << "\t" << iCluster << "\t" << zAtRmin << "\t" << zAtRmax << "\t" << mTrkParams.TrackletMaxDeltaZ[iLayer] << "\t" << mTrkParams.TrackletMaxDeltaPhi << std::endl;
-                  std::cout << currentCluster.zCoordinate << "\t" << primaryVertex.getZ() << "\t" << currentCluster.radius << std::endl;
-                  std::cout << tf->getMinR(iLayer + 1) << "\t" << currentCluster.radius << "\t" << currentCluster.zCoordinate << std::endl;
-                  std::cout << "Illegal access to IndexTable " << firstBinIndex << "\t" << maxBinIndex << "\t" << selectedBinsRect.z << "\t" << selectedBinsRect.x << std::endl;
-                  exit(1);
-                }
+            for (int iNextCluster{firstRowClusterIndex}; iNextCluster < maxRowClusterIndex; ++iNextCluster) {
+              if (iNextCluster >= (int)layer1.size()) {
+                break;
               }
-              const int firstRowClusterIndex = tf->getIndexTables(rof1)[iLayer][firstBinIndex];
-              const int maxRowClusterIndex = tf->getIndexTables(rof1)[iLayer][maxBinIndex];
+              const Cluster& nextCluster{layer1[iNextCluster]};
 
-              for (int iNextCluster{firstRowClusterIndex}; iNextCluster < maxRowClusterIndex; ++iNextCluster) {
-                if (iNextCluster >= (int)layer1.size()) {
-                  break;
-                }
-                const Cluster& nextCluster{layer1[iNextCluster]};
+              if (tf->isClusterUsed(iLayer + 1, nextCluster.clusterId)) {
+                continue;
+              }
 
-                if (tf->isClusterUsed(iLayer + 1, nextCluster.clusterId)) {
-                  continue;
-                }
+              const float deltaZ{gpu::GPUCommonMath::Abs(tanLambda * (nextCluster.radius - currentCluster.radius) +
+                                                         currentCluster.zCoordinate - nextCluster.zCoordinate)};
+              const float deltaPhi{gpu::GPUCommonMath::Abs(currentCluster.phi - nextCluster.phi)};
 
-                const float deltaZ{gpu::GPUCommonMath::Abs(tanLambda * (nextCluster.radius - currentCluster.radius) +
-                                                           currentCluster.zCoordinate - nextCluster.zCoordinate)};
-                const float deltaPhi{gpu::GPUCommonMath::Abs(currentCluster.phi - nextCluster.phi)};
-
-                if (deltaZ < mTrkParams.TrackletMaxDeltaZ[iLayer] &&
-                    (deltaPhi < mTrkParams.TrackletMaxDeltaPhi ||
-                     gpu::GPUCommonMath::Abs(deltaPhi - constants::math::TwoPi) < mTrkParams.TrackletMaxDeltaPhi)) {
-                  if (iLayer > 0) {
-                    tf->getTrackletsLookupTable()[iLayer - 1][currentSortedIndex]++;
-                  }
-                  tf->getTracklets()[iLayer].emplace_back(currentSortedIndex, tf->getSortedIndex(rof1, iLayer + 1, iNextCluster), currentCluster,
-                                                          nextCluster, rof0, rof1);
+              if (deltaZ < mTrkParams.TrackletMaxDeltaZ[iLayer] &&
+                  (deltaPhi < mTrkParams.TrackletMaxDeltaPhi ||
+                   gpu::GPUCommonMath::Abs(deltaPhi - constants::math::TwoPi) < mTrkParams.TrackletMaxDeltaPhi)) {
+                if (iLayer > 0) {
+                  tf->getTrackletsLookupTable()[iLayer - 1][currentSortedIndex]++;
                 }
+                tracklets.emplace_back(currentSortedIndex, tf->getSortedIndex(rof1, iLayer + 1, iNextCluster), currentCluster,
+                                       nextCluster, rof0, rof1);
               }
             }
           }
@@ -129,6 +147,12 @@ void TrackerTraitsCPU::computeLayerTracklets()
       }
     }
   }
+  for (auto& threadTracklets : trackletsTmp) {
+    for (int iLayer{0}; iLayer < nLayers; ++iLayer) {
+      tf->getTracklets()[iLayer].insert(tf->getTracklets()[iLayer].end(), threadTracklets[iLayer].begin(), threadTracklets[iLayer].end());
+    }
+  }
+
   /// Cold code, fixups
 
   for (int iLayer{0}; iLayer < mTrkParams.CellsPerRoad(); ++iLayer) {
@@ -200,6 +224,9 @@ void TrackerTraitsCPU::computeLayerTracklets()
 void TrackerTraitsCPU::computeLayerCells()
 {
   TimeFrame* tf = mTimeFrame;
+#ifdef WITH_OPENMP
+  omp_set_num_threads(mNThreads);
+#endif
   for (int iLayer{0}; iLayer < mTrkParams.CellsPerRoad(); ++iLayer) {
 
     if (tf->getTracklets()[iLayer + 1].empty() ||
@@ -209,102 +236,119 @@ void TrackerTraitsCPU::computeLayerCells()
 
     const int currentLayerTrackletsNum{static_cast<int>(tf->getTracklets()[iLayer].size())};
 
-    for (int iTracklet{0}; iTracklet < currentLayerTrackletsNum; ++iTracklet) {
-
-      const Tracklet& currentTracklet{tf->getTracklets()[iLayer][iTracklet]};
-      const int nextLayerClusterIndex{currentTracklet.secondClusterIndex};
-      const int nextLayerFirstTrackletIndex{
-        tf->getTrackletsLookupTable()[iLayer][nextLayerClusterIndex]};
-      const int nextLayerLastTrackletIndex{
-        tf->getTrackletsLookupTable()[iLayer][nextLayerClusterIndex + 1]};
-
-      if (nextLayerFirstTrackletIndex == nextLayerLastTrackletIndex) {
-        continue;
-      }
-
-      const Cluster& cellClus0{tf->getClusters()[iLayer][currentTracklet.firstClusterIndex]};
-      const Cluster& cellClus1{
-        tf->getClusters()[iLayer + 1][currentTracklet.secondClusterIndex]};
-      const float cellClus0R2{cellClus0.radius * cellClus0.radius};
-      const float cellClus1R2{cellClus1.radius * cellClus1.radius};
-      const float3 firstDeltaVector{cellClus1.xCoordinate - cellClus0.xCoordinate,
-                                    cellClus1.yCoordinate - cellClus0.yCoordinate,
-                                    cellClus1R2 - cellClus0R2};
-
-      for (int iNextTracklet{nextLayerFirstTrackletIndex}; iNextTracklet < nextLayerLastTrackletIndex; ++iNextTracklet) {
-        if (tf->getTracklets()[iLayer + 1][iNextTracklet].firstClusterIndex != nextLayerClusterIndex) {
-          break;
+    // tracklets are split in contiguous chunks processed concurrently, the cells of the chunks are merged in the tracklet order
+    const int nChunks{std::min(currentLayerTrackletsNum, 4 * mNThreads)};
+    std::vector<std::vector<Cell>> cellsTmp(nChunks);
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int iChunk = 0; iChunk < nChunks; ++iChunk) {
+      auto& cells = cellsTmp[iChunk];
+      const int firstTracklet{static_cast<int>(static_cast<long>(currentLayerTrackletsNum) * iChunk / nChunks)};
+      const int lastTracklet{static_cast<int>(static_cast<long>(currentLayerTrackletsNum) * (iChunk + 1) / nChunks)};
+      for (int iTracklet{firstTracklet}; iTracklet < lastTracklet; ++iTracklet) {
+
+        const Tracklet& currentTracklet{tf->getTracklets()[iLayer][iTracklet]};
+        const int nextLayerClusterIndex{currentTracklet.secondClusterIndex};
+        const int nextLayerFirstTrackletIndex{
+          tf->getTrackletsLookupTable()[iLayer][nextLayerClusterIndex]};
+        const int nextLayerLastTrackletIndex{
+          tf->getTrackletsLookupTable()[iLayer][nextLayerClusterIndex + 1]};
+
+        if (nextLayerFirstTrackletIndex == nextLayerLastTrackletIndex) {
+          continue;
         }
-        const Tracklet& nextTracklet{tf->getTracklets()[iLayer + 1][iNextTracklet]};
-        const float deltaTanLambda{std::abs(currentTracklet.tanLambda - nextTracklet.tanLambda)};
-        const float deltaPhi{std::abs(currentTracklet.phi - nextTracklet.phi)};
-
-        if (deltaTanLambda < mTrkParams.CellMaxDeltaTanLambda &&
-            (deltaPhi < mTrkParams.CellMaxDeltaPhi ||
-             std::abs(deltaPhi - constants::math::TwoPi) < mTrkParams.CellMaxDeltaPhi)) {
-
-          const float averageTanLambda{0.5f * (currentTracklet.tanLambda + nextTracklet.tanLambda)};
-          const float directionZIntersection{-averageTanLambda * cellClus0.radius +
-                                             cellClus0.zCoordinate};
-
-          unsigned short romin = std::min(std::min(currentTracklet.rof[0], currentTracklet.rof[1]), nextTracklet.rof[1]);
-          unsigned short romax = std::max(std::max(currentTracklet.rof[0], currentTracklet.rof[1]), nextTracklet.rof[1]);
-          bool deltaZflag{false};
-          gsl::span<const Vertex> primaryVertices{tf->getPrimaryVertices(romin, romax)};
-          for (const auto& primaryVertex : primaryVertices) {
-            deltaZflag |= std::abs(directionZIntersection - primaryVertex.getZ()) < mTrkParams.CellMaxDeltaZ[iLayer];
+
+        const Cluster& cellClus0{tf->getClusters()[iLayer][currentTracklet.firstClusterIndex]};
+        const Cluster& cellClus1{
+          tf->getClusters()[iLayer + 1][currentTracklet.secondClusterIndex]};
+        const float cellClus0R2{cellClus0.radius * cellClus0.radius};
+        const float cellClus1R2{cellClus1.radius * cellClus1.radius};
+        const float3 firstDeltaVector{cellClus1.xCoordinate - cellClus0.xCoordinate,
+                                      cellClus1.yCoordinate - cellClus0.yCoordinate,
+                                      cellClus1R2 - cellClus0R2};
+
+        for (int iNextTracklet{nextLayerFirstTrackletIndex}; iNextTracklet < nextLayerLastTrackletIndex; ++iNextTracklet) {
+          if (tf->getTracklets()[iLayer + 1][iNextTracklet].firstClusterIndex != nextLayerClusterIndex) {
+            break;
           }
+          const Tracklet& nextTracklet{tf->getTracklets()[iLayer + 1][iNextTracklet]};
+          const float deltaTanLambda{std::abs(currentTracklet.tanLambda - nextTracklet.tanLambda)};
+          const float deltaPhi{std::abs(currentTracklet.phi - nextTracklet.phi)};
+
+          if (deltaTanLambda < mTrkParams.CellMaxDeltaTanLambda &&
+              (deltaPhi < mTrkParams.CellMaxDeltaPhi ||
+               std::abs(deltaPhi - constants::math::TwoPi) < mTrkParams.CellMaxDeltaPhi)) {
+
+            const float averageTanLambda{0.5f * (currentTracklet.tanLambda + nextTracklet.tanLambda)};
+            const float directionZIntersection{-averageTanLambda * cellClus0.radius +
+                                               cellClus0.zCoordinate};
+
+            unsigned short romin = std::min(std::min(currentTracklet.rof[0], currentTracklet.rof[1]), nextTracklet.rof[1]);
+            unsigned short romax = std::max(std::max(currentTracklet.rof[0], currentTracklet.rof[1]), nextTracklet.rof[1]);
+            bool deltaZflag{false};
+            gsl::span<const Vertex> primaryVertices{tf->getPrimaryVertices(romin, romax)};
+            for (const auto& primaryVertex : primaryVertices) {
+              deltaZflag |= std::abs(directionZIntersection - primaryVertex.getZ()) < mTrkParams.CellMaxDeltaZ[iLayer];
+            }
 
-          if (deltaZflag) {
+            if (deltaZflag) {
 
-            const Cluster& thirdCellCluster{
-              tf->getClusters()[iLayer + 2][nextTracklet.secondClusterIndex]};
+              const Cluster& thirdCellCluster{
+                tf->getClusters()[iLayer + 2][nextTracklet.secondClusterIndex]};
 
-            const float thirdCellClusterR2{thirdCellCluster.radius *
-                                           thirdCellCluster.radius};
+              const float thirdCellClusterR2{thirdCellCluster.radius *
+                                             thirdCellCluster.radius};
 
-            const float3 secondDeltaVector{thirdCellCluster.xCoordinate - cellClus0.xCoordinate,
-                                           thirdCellCluster.yCoordinate - cellClus0.yCoordinate,
-                                           thirdCellClusterR2 - cellClus0R2};
+              const float3 secondDeltaVector{thirdCellCluster.xCoordinate - cellClus0.xCoordinate,
+                                             thirdCellCluster.yCoordinate - cellClus0.yCoordinate,
+                                             thirdCellClusterR2 - cellClus0R2};
 
-            float3 cellPlaneNormalVector{math_utils::crossProduct(firstDeltaVector, secondDeltaVector)};
+              float3 cellPlaneNormalVector{math_utils::crossProduct(firstDeltaVector, secondDeltaVector)};
 
-            const float vectorNorm{std::hypot(cellPlaneNormalVector.x, cellPlaneNormalVector.y, cellPlaneNormalVector.z)};
+              const float vectorNorm{std::hypot(cellPlaneNormalVector.x, cellPlaneNormalVector.y, cellPlaneNormalVector.z)};
 
-            if (vectorNorm < constants::math::FloatMinThreshold ||
-                std::abs(cellPlaneNormalVector.z) < constants::math::FloatMinThreshold) {
-              continue;
-            }
+              if (vectorNorm < constants::math::FloatMinThreshold ||
+                  std::abs(cellPlaneNormalVector.z) < constants::math::FloatMinThreshold) {
+                continue;
+              }
 
-            const float inverseVectorNorm{1.0f / vectorNorm};
-            const float3 normVect{cellPlaneNormalVector.x * inverseVectorNorm,
-                                  cellPlaneNormalVector.y * inverseVectorNorm,
-                                  cellPlaneNormalVector.z * inverseVectorNorm};
-            const float planeDistance{-normVect.x * (cellClus1.xCoordinate - tf->getBeamX()) - normVect.y * (cellClus1.yCoordinate - tf->getBeamY()) - normVect.z * cellClus1R2};
-            const float normVectZsquare{normVect.z * normVect.z};
-            const float cellRadius{std::sqrt(
-              (1.0f - normVectZsquare - 4.0f * planeDistance * normVect.z) /
-              (4.0f * normVectZsquare))};
-            const float2 circleCenter{-0.5f * normVect.x / normVect.z,
-                                      -0.5f * normVect.y / normVect.z};
-            const float dca{std::abs(cellRadius - std::hypot(circleCenter.x, circleCenter.y))};
-
-            if (dca > mTrkParams.CellMaxDCA[iLayer]) {
-              continue;
-            }
+              const float inverseVectorNorm{1.0f / vectorNorm};
+              const float3 normVect{cellPlaneNormalVector.x * inverseVectorNorm,
+                                    cellPlaneNormalVector.y * inverseVectorNorm,
+                                    cellPlaneNormalVector.z * inverseVectorNorm};
+              const float planeDistance{-normVect.x * (cellClus1.xCoordinate - tf->getBeamX()) - normVect.y * (cellClus1.yCoordinate - tf->getBeamY()) - normVect.z * cellClus1R2};
+              const float normVectZsquare{normVect.z * normVect.z};
+              const float cellRadius{std::sqrt(
+                (1.0f - normVectZsquare - 4.0f * planeDistance * normVect.z) /
+                (4.0f * normVectZsquare))};
+              const float2 circleCenter{-0.5f * normVect.x / normVect.z,
+                                        -0.5f * normVect.y / normVect.z};
+              const float dca{std::abs(cellRadius - std::hypot(circleCenter.x, circleCenter.y))};
+
+              if (dca > mTrkParams.CellMaxDCA[iLayer]) {
+                continue;
+              }
 
-            const float cellTrajectoryCurvature{1.0f / cellRadius};
-            if (iLayer > 0 && tf->getCellsLookupTable()[iLayer - 1].size() <= iTracklet) {
-              tf->getCellsLookupTable()[iLayer - 1].resize(iTracklet + 1, tf->getCells()[iLayer].size());
+              const float cellTrajectoryCurvature{1.0f / cellRadius};
+              cells.emplace_back(
+                currentTracklet.firstClusterIndex, nextTracklet.firstClusterIndex, nextTracklet.secondClusterIndex,
+                iTracklet, iNextTracklet, normVect, cellTrajectoryCurvature);
             }
-
-            tf->getCells()[iLayer].emplace_back(
-              currentTracklet.firstClusterIndex, nextTracklet.firstClusterIndex, nextTracklet.secondClusterIndex,
-              iTracklet, iNextTracklet, normVect, cellTrajectoryCurvature);
           }
         }
       }
     }
+
+    for (const auto& cells : cellsTmp) {
+      for (const auto& cell : cells) {
+        const int iTracklet{cell.getFirstTrackletIndex()};
+        if (iLayer > 0 && tf->getCellsLookupTable()[iLayer - 1].size() <= iTracklet) {
+          tf->getCellsLookupTable()[iLayer - 1].resize(iTracklet + 1, tf->getCells()[iLayer].size());
+        }
+        tf->getCells()[iLayer].push_back(cell);
+      }
+    }
     if (iLayer > 0) {
       tf->getCellsLookupTable()[iLayer - 1].resize(currentLayerTrackletsNum + 1, currentLayerTrackletsNum);
     }
@@ -81,6 +81,7 @@ void TrackerDPL::init(InitContext& ic)
     auto* chainITS = mRecChain->AddChain<o2::gpu::GPUChainITS>();
     mVertexer = std::make_unique<Vertexer>(chainITS->GetITSVertexerTraits());
     mTracker = std::make_unique<Tracker>(new TrackerTraitsCPU(&mTimeFrame));
+    mTracker->setNThreads(ic.options().get<int>("nthreads"));
 
     std::vector<TrackingParameters> trackParams;
     std::vector<MemoryParameters> memParams;
@@ -312,7 +313,8 @@ DataProcessorSpec getTrackerSpec(bool useMC, const std::string& trModeS, o2::gpu
     Options{
       {"grp-file", VariantType::String, "o2sim_grp.root", {"Name of the grp file"}},
       {"its-dictionary-path", VariantType::String, "", {"Path of the cluster-topology dictionary file"}},
-      {"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}}}};
+      {"material-lut-path", VariantType::String, "", {"Path of the material LUT file"}},
+      {"nthreads", VariantType::Int, 1, {"Number of threads"}}}};
 }
 
 } // namespace its
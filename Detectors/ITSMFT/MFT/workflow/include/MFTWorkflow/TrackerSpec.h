@@ -40,7 +40,8 @@ class TrackerDPL : public o2::framework::Task
   bool mUseMC = false;
   o2::itsmft::TopologyDictionary mDict;
   std::unique_ptr<o2::parameters::GRPObject> mGRP = nullptr;
-  std::unique_ptr<o2::mft::Tracker> mTracker = nullptr;
+  std::vector<std::unique_ptr<o2::mft::Tracker>> mTrackers; ///< one tracker per thread
+  int mNThreads = 1;
   TStopwatch mTimer;
 };
 
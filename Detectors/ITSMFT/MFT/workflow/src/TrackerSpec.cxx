@@ -35,6 +35,10 @@
 #include "DetectorsBase/Propagator.h"
 #include "DetectorsCommonDataFormats/NameConf.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 using namespace o2::framework;
 
 namespace o2
@@ -60,12 +64,22 @@ void TrackerDPL::init(InitContext& ic)
 
     // tracking configuration parameters
     auto& trackingParam = MFTTrackingParam::Instance();
-    // create the tracker: set the B-field, the configuration and initialize
-    mTracker = std::make_unique<o2::mft::Tracker>(mUseMC);
+    // create the trackers, one per thread: set the B-field, the configuration and initialize
+    mNThreads = std::max(1, ic.options().get<int>("nthreads"));
+#ifndef WITH_OPENMP
+    if (mNThreads > 1) {
+      LOG(WARNING) << "MFTTracker: multithreading is not supported, processing the ROframes sequentially";
+      mNThreads = 1;
+    }
+#endif
     double centerMFT[3] = {0, 0, -61.4}; // Field at center of MFT
-    mTracker->setBz(field->getBz(centerMFT));
-    mTracker->initConfig(trackingParam, true);
-    mTracker->initialize(trackingParam.FullClusterScan);
+    for (int i = 0; i < mNThreads; i++) {
+      auto& tracker = mTrackers.emplace_back(std::make_unique<o2::mft::Tracker>(mUseMC));
+      tracker->setBz(field->getBz(centerMFT));
+      tracker->initConfig(trackingParam, i == 0);
+      tracker->initialize(trackingParam.FullClusterScan);
+    }
+    LOG(INFO) << "MFTTracker: processing the ROframes with " << mNThreads << " thread(s)";
   } else {
     throw std::runtime_error(o2::utils::Str::concat_string("Cannot retrieve GRP from the ", filename));
   }
@@ -115,9 +129,6 @@ void TrackerDPL::run(ProcessingContext& pc)
   std::vector<o2::mft::TrackCA> tracksCA;
   auto& allTracksMFT = pc.outputs().make<std::vector<o2::mft::TrackMFT>>(Output{"MFT", "TRACKS", 0, Lifetime::Timeframe});
 
-  std::uint32_t roFrame = 0;
-  o2::mft::ROframe event(0);
-
   Bool_t continuous = mGRP->isDetContinuousReadOut("MFT");
   LOG(INFO) << "MFTTracker RO: continuous=" << continuous;
 
@@ -125,7 +136,7 @@ void TrackerDPL::run(ProcessingContext& pc)
   auto& trackingParam = MFTTrackingParam::Instance();
 
   // snippet to convert found tracks to final output tracks with separate cluster indices
-  auto copyTracks = [&event](auto& tracks, auto& allTracks, auto& allClusIdx) {
+  auto copyTracks = [](auto& tracks, auto& allTracks, auto& allClusIdx) {
     for (auto& trc : tracks) {
       trc.setExternalClusterIndexOffset(allClusIdx.size());
       int ncl = trc.getNumberOfPoints();
@@ -137,39 +148,88 @@ void TrackerDPL::run(ProcessingContext& pc)
     }
   };
 
+  // snippet to find the tracks of a loaded ROframe with the given tracker and compute their MC labels
+  auto findTracks = [this](o2::mft::Tracker& tracker, o2::mft::ROframe& event, std::vector<o2::MCCompLabel>& trackLabels) {
+    tracker.setROFrame(event.getROFrameId());
+    tracker.clustersToTracks(event);
+    if (mUseMC) {
+      tracker.computeTracksMClabels(event.getTracksLTF());
+      tracker.computeTracksMClabels(event.getTracksCA());
+      trackLabels.swap(tracker.getTrackLabels());
+    }
+  };
+
+  // snippet to store the tracks of a ROframe in the output
+  auto storeTracks = [&](o2::itsmft::ROFRecord& rof, o2::mft::ROframe& event, std::vector<o2::MCCompLabel>& trackLabels) {
+    tracksLTF.swap(event.getTracksLTF());
+    tracksCA.swap(event.getTracksCA());
+    nTracksLTF += tracksLTF.size();
+    nTracksCA += tracksCA.size();
+
+    if (mUseMC) {
+      std::copy(trackLabels.begin(), trackLabels.end(), std::back_inserter(allTrackLabels));
+      trackLabels.clear();
+    }
+
+    LOG(INFO) << "Found tracks LTF: " << tracksLTF.size();
+    LOG(INFO) << "Found tracks CA: " << tracksCA.size();
+    int first = allTracksMFT.size();
+    int number = tracksLTF.size() + tracksCA.size();
+    rof.setFirstEntry(first);
+    rof.setNEntries(number);
+    copyTracks(tracksLTF, allTracksMFT, allClusIdx);
+    copyTracks(tracksCA, allTracksMFT, allClusIdx);
+  };
+
   gsl::span<const unsigned char>::iterator pattIt = patterns.begin();
+  if (mNThreads > 1) {
+    // the cluster patterns are read sequentially: load all ROframes first, then find the tracks
+    // in each of them in parallel, with one tracker per thread, and store them in the original order
+    int nROFs = rofs.size();
+    std::vector<o2::mft::ROframe> events;
+    events.reserve(nROFs);
+    std::vector<int> nclUsed(nROFs);
+    std::vector<std::vector<o2::MCCompLabel>> rofTrackLabels(mUseMC ? nROFs : 0);
+    for (int roFrame = 0; roFrame < nROFs; roFrame++) {
+      auto& event = events.emplace_back(roFrame);
+      nclUsed[roFrame] = ioutils::loadROFrameData(rofs[roFrame], event, compClusters, pattIt, mDict, labels, mTrackers[0].get());
+      if (nclUsed[roFrame]) {
+        event.initialize(trackingParam.FullClusterScan);
+        LOG(INFO) << "ROframe: " << roFrame << ", clusters loaded : " << nclUsed[roFrame];
+      }
+    }
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+    for (int roFrame = 0; roFrame < nROFs; roFrame++) {
+      if (nclUsed[roFrame]) {
+        int iThread = 0;
+#ifdef WITH_OPENMP
+        iThread = omp_get_thread_num();
+#endif
+        findTracks(*mTrackers[iThread], events[roFrame], mUseMC ? rofTrackLabels[roFrame] : trackLabels);
+      }
+    }
+    for (int roFrame = 0; roFrame < nROFs; roFrame++) {
+      if (nclUsed[roFrame]) {
+        storeTracks(rofs[roFrame], events[roFrame], mUseMC ? rofTrackLabels[roFrame] : trackLabels);
+      }
+    }
+  } else {
+    std::uint32_t roFrame = 0;
+    o2::mft::ROframe event(0);
     for (auto& rof : rofs) {
-      int nclUsed = ioutils::loadROFrameData(rof, event, compClusters, pattIt, mDict, labels, mTracker.get());
+      int nclUsed = ioutils::loadROFrameData(rof, event, compClusters, pattIt, mDict, labels, mTrackers[0].get());
       if (nclUsed) {
         event.setROFrameId(roFrame);
         event.initialize(trackingParam.FullClusterScan);
         LOG(INFO) << "ROframe: " << roFrame << ", clusters loaded : " << nclUsed;
-        mTracker->setROFrame(roFrame);
-        mTracker->clustersToTracks(event);
-        tracksLTF.swap(event.getTracksLTF());
-        tracksCA.swap(event.getTracksCA());
-        nTracksLTF += tracksLTF.size();
-        nTracksCA += tracksCA.size();
-
-        if (mUseMC) {
-          mTracker->computeTracksMClabels(tracksLTF);
-          mTracker->computeTracksMClabels(tracksCA);
-          trackLabels.swap(mTracker->getTrackLabels());
-          std::copy(trackLabels.begin(), trackLabels.end(), std::back_inserter(allTrackLabels));
-          trackLabels.clear();
-        }
-
-        LOG(INFO) << "Found tracks LTF: " << tracksLTF.size();
-        LOG(INFO) << "Found tracks CA: " << tracksCA.size();
-        int first = allTracksMFT.size();
-        int number = tracksLTF.size() + tracksCA.size();
-        rof.setFirstEntry(first);
-        rof.setNEntries(number);
-        copyTracks(tracksLTF, allTracksMFT, allClusIdx);
-        copyTracks(tracksCA, allTracksMFT, allClusIdx);
+        findTracks(*mTrackers[0], event, trackLabels);
+        storeTracks(rof, event, trackLabels);
       }
       roFrame++;
     }
+  }
 
   LOG(INFO) << "MFTTracker found " << nTracksLTF << " tracks LTF";
   LOG(INFO) << "MFTTracker found " << nTracksCA << " tracks CA";
@@ -214,7 +274,8 @@ DataProcessorSpec getTrackerSpec(bool useMC)
     AlgorithmSpec{adaptFromTask<TrackerDPL>(useMC)},
     Options{
       {"grp-file", VariantType::String, "o2sim_grp.root", {"Name of the output file"}},
-      {"mft-dictionary-path", VariantType::String, "", {"Path of the cluster-topology dictionary file"}}}};
+      {"mft-dictionary-path", VariantType::String, "", {"Path of the cluster-topology dictionary file"}},
+      {"nthreads", VariantType::Int, 1, {"Number of threads to process the ROframes"}}}};
 }
 
 } // namespace mft
@@ -115,8 +115,8 @@ void CTFCoder::encode(VEC& buff, const gsl::span<const ROFRecord>& rofRecVec, co
   assignDictVersion(static_cast<o2::ctf::CTFDictHeader&>(ec->getHeader()));
   ec->getANSHeader().majorVersion = 0;
   ec->getANSHeader().minorVersion = 1;
-  // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
-#define ENCODEITSMFT(part, slot, bits) CTF::get(buff.data())->encode(part, int(slot), bits, optField[int(slot)], &buff, mCoders[int(slot)].get());
+  ColumnsEncoder<CTF, VEC> columns(*this, buff, optField);
+#define ENCODEITSMFT(part, slot, bits) columns.add(part, int(slot), bits);
   // clang-format off
   ENCODEITSMFT(compCl.firstChipROF, CTF::BLCfirstChipROF, 0);
   ENCODEITSMFT(compCl.bcIncROF, CTF::BLCbcIncROF, 0);
@@ -130,6 +130,7 @@ void CTFCoder::encode(VEC& buff, const gsl::span<const ROFRecord>& rofRecVec, co
   ENCODEITSMFT(compCl.pattID, CTF::BLCpattID, 0);
   ENCODEITSMFT(compCl.pattMap, CTF::BLCpattMap, 0);
   // clang-format on
+  columns.finalize();
   CTF::get(buff.data())->print(getPrefix());
 }
 
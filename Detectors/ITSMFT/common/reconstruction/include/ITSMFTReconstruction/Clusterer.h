@@ -22,6 +22,7 @@
 
 #include <utility>
 #include <vector>
+#include <array>
 #include <cstring>
 #include <memory>
 #include <gsl/span>
@@ -139,6 +140,24 @@ class Clusterer
     std::array<Label, MaxLabels> labelsBuff;                        //! temporary buffer for building cluster labels
     std::vector<PixelData> pixArrBuff;                              //! temporary buffer for pattern calc.
     //
+    /// data of the column masks clustering kernel: the fired rows of the column are packed to 64-bit words and the
+    /// runs of contiguous rows extracted from them are connected to the runs of the previous column
+    struct PixelRun {
+      uint16_t col = 0;
+      uint16_t rowMin = 0;
+      uint16_t rowMax = 0;
+    };
+    static constexpr int NColumnWords = (SegmentationAlpide::NRows + 63) / 64;
+    std::array<uint64_t, NColumnWords> columnMask{}; ///< fired rows of the current column
+    std::vector<PixelRun> runs;                      ///< runs of fired rows of the chip, ordered in column and row
+    std::vector<int> runParent;                      ///< union-find parent of the run, the root is the run with the smallest index
+    std::vector<int> runNext;                        ///< next run of the same cluster
+    std::vector<int> runCluster;                     ///< cluster of the run
+    std::vector<int> clusterHeads;                   ///< 1st run of the cluster
+    std::vector<int> clusterTails;                   ///< last run of the cluster
+    int prevColFirstRun = 0;                         ///< 1st run of the previous column
+    uint16_t prevRunsCol = 0xffff;                   ///< previous column with runs
+    //
     /// temporary storage for the thread output
     CompClusCont compClusters;
     PatternCont patterns;
@@ -171,6 +190,27 @@ class Clusterer
       curr[row] = lastIndex; // store index of the new precluster in the current column buffer
     }
 
+    ///< find the root of the run in the union-find forest, compressing the path
+    int findRunRoot(int ir)
+    {
+      while (runParent[ir] != ir) {
+        ir = runParent[ir] = runParent[runParent[ir]];
+      }
+      return ir;
+    }
+
+    ///< merge the clusters of 2 runs, the run with smaller index becomes the root
+    void uniteRuns(int ir1, int ir2)
+    {
+      ir1 = findRunRoot(ir1);
+      ir2 = findRunRoot(ir2);
+      if (ir1 < ir2) {
+        runParent[ir2] = ir1;
+      } else if (ir2 < ir1) {
+        runParent[ir1] = ir2;
+      }
+    }
+
     void fetchMCLabels(int digID, const ConstMCTruth* labelsDig, int& nfilled);
     void initChip(const ChipPixelData* curChipData, uint32_t first);
     void updateChip(const ChipPixelData* curChipData, uint32_t ip);
@@ -178,6 +218,9 @@ class Clusterer
                     const ConstMCTruth* labelsDig, MCTruth* labelsClus);
     void finishChipSingleHitFast(uint32_t hit, ChipPixelData* curChipData, CompClusCont* compClusPtr,
                                  PatternCont* patternsPtr, const ConstMCTruth* labelsDigPtr, MCTruth* labelsClusPTr);
+    void processChipColumnMasks(const ChipPixelData* curChipData, uint32_t first, CompClusCont* compClusPtr, PatternCont* patternsPtr);
+    void addColumnRuns(uint16_t col);
+    void streamPixArrBuff(const BBox& bbox, CompClusCont* compClusPtr, PatternCont* patternsPtr, MCTruth* labelsClusPtr, int nlab);
     void process(uint16_t chip, uint16_t nChips, CompClusCont* compClusPtr, PatternCont* patternsPtr,
                  const ConstMCTruth* labelsDigPtr, MCTruth* labelsClPtr, const ROFRecord& rofPtr);
 
@@ -210,6 +253,9 @@ class Clusterer
   int getMaxRowColDiffToMask() const { return mMaxRowColDiffToMask; }
   void setMaxRowColDiffToMask(int v) { mMaxRowColDiffToMask = v; }
 
+  bool isColumnMaskClustering() const { return mColumnMaskClustering; }
+  void setColumnMaskClustering(bool v) { mColumnMaskClustering = v; }
+
   void print() const;
   void clear();
 
@@ -235,6 +281,7 @@ class Clusterer
   ///< mask continuosly fired pixels in frames separated by less than this amount of BCs (fired from hit in prev. ROF)
   int mMaxBCSeparationToMask = 6000. / o2::constants::lhc::LHCBunchSpacingNS + 10;
   int mMaxRowColDiffToMask = 0; ///< provide their difference in col/row is <= than this
+  bool mColumnMaskClustering = false; ///< use column masks clustering kernel for the data w/o MC labels (exact connected components)
 
   std::vector<std::unique_ptr<ClustererThread>> mThreads; // buffers for threads
   std::vector<ChipPixelData> mChips;                      // currently processed ROF's chips data
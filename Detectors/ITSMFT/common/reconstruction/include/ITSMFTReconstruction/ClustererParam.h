@@ -33,8 +33,12 @@ struct ClustererParam : public o2::conf::ConfigurableParamHelper<ClustererParam<
     return N == o2::detectors::DetID::ITS ? ParamName[0] : ParamName[1];
   }
 
-  int maxRowColDiffToMask = 0;  ///< pixel may be masked as overflow if such a neighbour in prev frame was fired
-  int maxBCDiffToMaskBias = 10; ///< mask if 2 ROFs differ by <= StrobeLength + Bias BCs, use value <0 to disable masking
+  int maxRowColDiffToMask = 0;       ///< pixel may be masked as overflow if such a neighbour in prev frame was fired
+  int maxBCDiffToMaskBias = 10;      ///< mask if 2 ROFs differ by <= StrobeLength + Bias BCs, use value <0 to disable masking
+  /// use column bit-masks clustering kernel (for the data w/o MC labels). It gives the exact connected components of
+  /// the fired pixels, while the standard kernel may split a cluster whose preclusters need transitive merging
+  /// (e.g. a comb whose teeth are joined in different columns): the outputs differ for such clusters
+  bool columnMaskClustering = false;
 
   O2ParamDef(ClustererParam, getParamName().data());
 
@@ -15,6 +15,7 @@
 #define ALICEO2_ITSMFT_RAWPIXELDECODER_H_
 
 #include <array>
+#include <algorithm>
 #include <TStopwatch.h>
 #include "Framework/Logger.h"
 #include "ITSMFTReconstruction/ChipMappingITS.h"
@@ -27,6 +28,7 @@
 #include "ITSMFTReconstruction/RUDecodeData.h"
 #include "ITSMFTReconstruction/PixelReader.h"
 #include "DataFormatsITSMFT/ROFRecord.h"
+#include "DataFormatsITSMFT/Digit.h"
 #include "ITSMFTReconstruction/PixelData.h"
 
 namespace o2
@@ -104,6 +106,8 @@ class RawPixelDecoder final : public PixelReader
 
  private:
   void setupLinks(o2::framework::InputRecord& inputs);
+  int prepareDigitSlices();
+  void fillDigitSlices(Digit* digits) const;
   int getRUEntrySW(int ruSW) const { return mRUEntry[ruSW]; }
   RUDecodeData* getRUDecode(int ruSW) { return &mRUDecodeVec[mRUEntry[ruSW]]; }
   GBTLink* getGBTLink(int i) { return i < 0 ? nullptr : &mGBTLinks[i]; }
@@ -116,6 +120,7 @@ class RawPixelDecoder final : public PixelReader
   std::vector<RUDecodeData> mRUDecodeVec;                   // set of active RUs
   std::array<short, Mapping::getNRUs()> mRUEntry;           // entry of the RU with given SW ID in the mRUDecodeVec
   std::vector<ChipPixelData*> mOrderedChipsPtr;             // special ordering helper used for the MFT (its chipID is not contiguous in RU)
+  std::vector<int> mDigitSliceOffsets;                      // offsets of the per-RU (per-chip for the MFT) slices of the decoded digits of the ROF
   std::string mSelfName;                        // self name
   header::DataOrigin mUserDataOrigin = o2::header::gDataOriginInvalid; // alternative user-provided data origin to pick
   header::DataDescription mUserDataDescription = o2::header::gDataDescriptionInvalid; // alternative user-provided description to pick
@@ -139,7 +144,9 @@ class RawPixelDecoder final : public PixelReader
 };
 
 ///______________________________________________________________
-/// Fill decoded digits to global vector
+/// Fill decoded digits to global vector (e.g. the DPL output buffer): the space for the whole ROF is allocated
+/// at once and the slices of the different RUs are filled in parallel. The decoded data remain available for
+/// the getNextChipData calls (e.g. by the clusterer)
 template <class Mapping>
 template <class DigitContainer, class ROFContainer>
 int RawPixelDecoder<Mapping>::fillDecodedDigits(DigitContainer& digits, ROFContainer& rofs)
@@ -149,41 +156,9 @@ int RawPixelDecoder<Mapping>::fillDecodedDigits(DigitContainer& digits, ROFConta
   }
   mTimerFetchData.Start(false);
   int ref = digits.size();
-  for (unsigned int iru = 0; iru < mRUDecodeVec.size(); iru++) {
-    for (int ic = 0; ic < mRUDecodeVec[iru].nChipsFired; ic++) {
-      const auto& chip = mRUDecodeVec[iru].chipsData[ic];
-      for (const auto& hit : mRUDecodeVec[iru].chipsData[ic].getData()) {
-        digits.emplace_back(chip.getChipID(), hit.getRow(), hit.getCol());
-      }
-    }
-  }
-  int nFilled = digits.size() - ref;
-  rofs.emplace_back(mInteractionRecord, mROFCounter, ref, nFilled);
-  mTimerFetchData.Stop();
-  return nFilled;
-}
-
-///______________________________________________________________
-/// Fill decoded digits to global vector
-template <>
-template <class DigitContainer, class ROFContainer>
-int RawPixelDecoder<ChipMappingMFT>::fillDecodedDigits(DigitContainer& digits, ROFContainer& rofs)
-{
-  if (mInteractionRecord.isDummy()) {
-    return 0; // nothing was decoded
-  }
-  mTimerFetchData.Start(false);
-  int ref = digits.size();
-  while (!mOrderedChipsPtr.empty()) {
-    const auto& chipData = *mOrderedChipsPtr.back();
-    assert(mLastReadChipID < chipData.getChipID());
-    mLastReadChipID = chipData.getChipID();
-    for (const auto& hit : chipData.getData()) {
-      digits.emplace_back(mLastReadChipID, hit.getRow(), hit.getCol());
-    }
-    mOrderedChipsPtr.pop_back();
-  }
-  int nFilled = digits.size() - ref;
+  int nFilled = prepareDigitSlices();
+  digits.resize(ref + nFilled);
+  fillDigitSlices(digits.data() + ref);
   rofs.emplace_back(mInteractionRecord, mROFCounter, ref, nFilled);
   mTimerFetchData.Stop();
   return nFilled;
@@ -198,6 +173,7 @@ void RawPixelDecoder<Mapping>::fillCalibData(CalibContainer& calib)
   if (!mInteractionRecord.isDummy()) {
     auto curSize = calib.size();
     calib.resize(curSize + Mapping::getNRUs());
+    std::fill(calib.begin() + curSize, calib.end(), GBTCalibData{}); // the output buffer may skip default initialization
     for (unsigned int iru = 0; iru < mRUDecodeVec.size(); iru++) {
       calib[curSize + mRUDecodeVec[iru].ruSWID] = mRUDecodeVec[iru].calibData;
     }
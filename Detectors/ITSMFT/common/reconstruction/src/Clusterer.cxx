@@ -178,6 +178,8 @@ void Clusterer::ClustererThread::process(uint16_t chip, uint16_t nChips, CompClu
       auto valp = validPixID++;
       if (validPixID == npix) { // special case of a single pixel fired on the chip
         finishChipSingleHitFast(valp, curChipData, compClusPtr, patternsPtr, labelsDigPtr, labelsClPtr);
+      } else if (parent->mColumnMaskClustering && !labelsClPtr) { // MC labels are supported only by the standard kernel
+        processChipColumnMasks(curChipData, valp, compClusPtr, patternsPtr);
       } else {
         initChip(curChipData, valp);
         for (; validPixID < npix; validPixID++) {
@@ -241,35 +243,155 @@ void Clusterer::ClustererThread::finishChip(ChipPixelData* curChipData, CompClus
       }
       preClusterIndices[i2] = -1;
     }
+    streamPixArrBuff(bbox, compClusPtr, patternsPtr, labelsClusPtr, nlab);
+  }
+}
 
-    if (bbox.isAcceptableSize()) {
-      parent->streamCluster(pixArrBuff, &labelsBuff, bbox, parent->mPattIdConverter, compClusPtr, patternsPtr, labelsClusPtr, nlab);
-    } else {
-      LOG(WARNING) << "Splitting a huge cluster !  ChipID: " << bbox.chipID;
-      BBox bboxT(bbox); // truncated box
-      std::vector<PixelData> pixbuf;
-      do {
-        bboxT.rowMin = bbox.rowMin;
-        bboxT.colMax = std::min(bbox.colMax, uint16_t(bboxT.colMin + o2::itsmft::ClusterPattern::MaxColSpan - 1));
-        do { // Select a subset of pixels fitting the reduced bounding box
-          bboxT.rowMax = std::min(bbox.rowMax, uint16_t(bboxT.rowMin + o2::itsmft::ClusterPattern::MaxRowSpan - 1));
-          for (const auto& pix : pixArrBuff) {
-            if (bbox.isInside(pix.getRowDirect(), pix.getCol())) {
-              pixbuf.push_back(pix);
-            }
-          }
-          if (!pixbuf.empty()) { // Stream a piece of cluster only if the reduced bounding box is not empty
-            parent->streamCluster(pixbuf, &labelsBuff, bboxT, parent->mPattIdConverter, compClusPtr, patternsPtr, labelsClusPtr, nlab, true);
-            pixbuf.clear();
+//__________________________________________________
+void Clusterer::ClustererThread::streamPixArrBuff(const BBox& bbox, CompClusCont* compClusPtr, PatternCont* patternsPtr,
+                                                  MCTruth* labelsClusPtr, int nlab)
+{
+  // stream the cluster made of the pixels accumulated in the pixArrBuff, splitting it if needed
+  if (bbox.isAcceptableSize()) {
+    parent->streamCluster(pixArrBuff, &labelsBuff, bbox, parent->mPattIdConverter, compClusPtr, patternsPtr, labelsClusPtr, nlab);
+  } else {
+    LOG(WARNING) << "Splitting a huge cluster !  ChipID: " << bbox.chipID;
+    BBox bboxT(bbox); // truncated box
+    std::vector<PixelData> pixbuf;
+    do {
+      bboxT.rowMin = bbox.rowMin;
+      bboxT.colMax = std::min(bbox.colMax, uint16_t(bboxT.colMin + o2::itsmft::ClusterPattern::MaxColSpan - 1));
+      do { // Select a subset of pixels fitting the reduced bounding box
+        bboxT.rowMax = std::min(bbox.rowMax, uint16_t(bboxT.rowMin + o2::itsmft::ClusterPattern::MaxRowSpan - 1));
+        for (const auto& pix : pixArrBuff) {
+          if (bbox.isInside(pix.getRowDirect(), pix.getCol())) {
+            pixbuf.push_back(pix);
           }
-          bboxT.rowMin = bboxT.rowMax + 1;
-        } while (bboxT.rowMin < bbox.rowMax);
-        bboxT.colMin = bboxT.colMax + 1;
-      } while (bboxT.colMin < bbox.colMax);
+        }
+        if (!pixbuf.empty()) { // Stream a piece of cluster only if the reduced bounding box is not empty
+          parent->streamCluster(pixbuf, &labelsBuff, bboxT, parent->mPattIdConverter, compClusPtr, patternsPtr, labelsClusPtr, nlab, true);
+          pixbuf.clear();
+        }
+        bboxT.rowMin = bboxT.rowMax + 1;
+      } while (bboxT.rowMin < bbox.rowMax);
+      bboxT.colMin = bboxT.colMax + 1;
+    } while (bboxT.colMin < bbox.colMax);
+  }
+}
+
+//__________________________________________________
+void Clusterer::ClustererThread::processChipColumnMasks(const ChipPixelData* curChipData, uint32_t first,
+                                                        CompClusCont* compClusPtr, PatternCont* patternsPtr)
+{
+  // alternative clustering kernel: the fired rows of every column are packed to bit masks, the runs of contiguous
+  // rows are found by bit operations on the mask words and connected to the overlapping runs of the previous column.
+  // The clusters are streamed in the order of their 1st pixel, as in the standard kernel
+  const auto& pixData = curChipData->getData();
+  runs.clear();
+  runParent.clear();
+  prevColFirstRun = 0;
+  prevRunsCol = 0xffff;
+  uint16_t col = pixData[first].getCol();
+  for (uint32_t ip = first; ip < pixData.size(); ip++) {
+    const auto& pix = pixData[ip];
+    if (pix.isMasked()) {
+      continue;
+    }
+    if (pix.getCol() != col) {
+      addColumnRuns(col);
+      col = pix.getCol();
+    }
+    uint16_t row = pix.getRowDirect(); // can use getRowDirect since the pixel is not masked
+    columnMask[row >> 6] |= uint64_t(1) << (row & 0x3f);
+  }
+  addColumnRuns(col);
+
+  // build the lists of runs of every cluster, the root run precedes other runs of its cluster
+  int nruns = runs.size();
+  runNext.assign(nruns, -1);
+  runCluster.resize(nruns);
+  clusterHeads.clear();
+  clusterTails.clear();
+  for (int ir = 0; ir < nruns; ir++) {
+    int root = findRunRoot(ir);
+    if (root == ir) {
+      runCluster[ir] = clusterHeads.size();
+      clusterHeads.push_back(ir);
+      clusterTails.push_back(ir);
+    } else {
+      int icl = runCluster[ir] = runCluster[root];
+      runNext[clusterTails[icl]] = ir;
+      clusterTails[icl] = ir;
+    }
+  }
+  for (auto next : clusterHeads) {
+    BBox bbox(curChipData->getChipID());
+    pixArrBuff.clear();
+    while (next >= 0) {
+      const auto& run = runs[next];
+      for (uint16_t row = run.rowMin; row <= run.rowMax; row++) {
+        pixArrBuff.emplace_back(row, run.col);
+      }
+      bbox.adjust(run.rowMin, run.col);
+      bbox.adjust(run.rowMax, run.col);
+      next = runNext[next];
     }
+    streamPixArrBuff(bbox, compClusPtr, patternsPtr, nullptr, 0);
   }
 }
 
+//__________________________________________________
+void Clusterer::ClustererThread::addColumnRuns(uint16_t col)
+{
+  // extract the runs of the column mask (they may cross the words boundaries), reset the mask and
+  // connect the new runs to the runs of the previous column
+  int colFirstRun = runs.size();
+  uint64_t carry = 0; // highest bit of the previous word
+  for (int iw = 0; iw < NColumnWords; iw++) {
+    uint64_t word = columnMask[iw];
+    if (!word) {
+      carry = 0;
+      continue;
+    }
+    uint64_t nextBit = iw + 1 < NColumnWords ? (columnMask[iw + 1] & 0x1) : 0;
+    uint64_t starts = word & ~((word << 1) | carry);
+    uint64_t ends = word & ~((word >> 1) | (nextBit << 63));
+    carry = word >> 63;
+    columnMask[iw] = 0;
+    uint16_t rowOffs = iw << 6;
+    while (starts | ends) { // run start precedes its end, the end of the run precedes the start of the next one
+      if (starts && (!ends || __builtin_ctzll(starts) <= __builtin_ctzll(ends))) {
+        uint16_t row = rowOffs + __builtin_ctzll(starts);
+        runParent.push_back(runs.size());
+        runs.push_back(PixelRun{col, row, row});
+        starts &= starts - 1;
+      } else {
+        runs.back().rowMax = rowOffs + __builtin_ctzll(ends);
+        ends &= ends - 1;
+      }
+    }
+  }
+  int nruns = runs.size();
+  if (prevRunsCol + 1 == col) {
+#ifdef _ALLOW_DIAGONAL_ALPIDE_CLUSTERS_
+    constexpr int margin = 1;
+#else
+    constexpr int margin = 0;
+#endif
+    int ip = prevColFirstRun;
+    for (int ir = colFirstRun; ir < nruns; ir++) {
+      while (ip < colFirstRun && runs[ip].rowMax + margin < runs[ir].rowMin) {
+        ip++;
+      }
+      for (int jp = ip; jp < colFirstRun && runs[jp].rowMin <= runs[ir].rowMax + margin; jp++) {
+        uniteRuns(jp, ir);
+      }
+    }
+  }
+  prevColFirstRun = colFirstRun;
+  prevRunsCol = col;
+}
+
 //__________________________________________________
 void Clusterer::ClustererThread::finishChipSingleHitFast(uint32_t hit, ChipPixelData* curChipData, CompClusCont* compClusPtr,
                                                          PatternCont* patternsPtr, const ConstMCTruth* labelsDigPtr, MCTruth* labelsClusPtr)
@@ -426,6 +548,9 @@ void Clusterer::print() const
   // print settings
   LOG(INFO) << "Clusterizer masks overflow pixels separated by < " << mMaxBCSeparationToMask << " BC and <= "
             << mMaxRowColDiffToMask << " in row/col";
+  if (mColumnMaskClustering) {
+    LOG(INFO) << "Clusterizer uses column masks kernel for the data w/o MC labels";
+  }
 #ifdef _PERFORM_TIMING_
   auto& tmr = const_cast<TStopwatch&>(mTimer); // ugly but this is what root does internally
   auto& tmrm = const_cast<TStopwatch&>(mTimerMerge);
@@ -327,7 +327,7 @@ template <>
 ChipPixelData* RawPixelDecoder<ChipMappingMFT>::getNextChipData(std::vector<ChipPixelData>& chipDataVec)
 {
   if (!mOrderedChipsPtr.empty()) {
-    auto chipData = *mOrderedChipsPtr.back();
+    auto& chipData = *mOrderedChipsPtr.back();
     assert(mLastReadChipID < chipData.getChipID());
     mLastReadChipID = chipData.getChipID();
     chipDataVec[mLastReadChipID].swap(chipData);
@@ -346,7 +346,7 @@ template <>
 bool RawPixelDecoder<ChipMappingMFT>::getNextChipData(ChipPixelData& chipData)
 {
   if (!mOrderedChipsPtr.empty()) {
-    auto ruChip = *mOrderedChipsPtr.back();
+    auto& ruChip = *mOrderedChipsPtr.back();
     assert(mLastReadChipID < ruChip.getChipID());
     mLastReadChipID = ruChip.getChipID();
     ruChip.swap(chipData);
@@ -360,6 +360,79 @@ bool RawPixelDecoder<ChipMappingMFT>::getNextChipData(ChipPixelData& chipData)
   return getNextChipData(chipData); // is it ok to use recursion here?
 }
 
+///______________________________________________________________________
+/// define the slices of the RUs in the decoded digits of the ROF, return the total number of digits
+template <class Mapping>
+int RawPixelDecoder<Mapping>::prepareDigitSlices()
+{
+  int nru = mRUDecodeVec.size();
+  mDigitSliceOffsets.resize(nru + 1);
+  mDigitSliceOffsets[0] = 0;
+  for (int iru = 0; iru < nru; iru++) {
+    const auto& ru = mRUDecodeVec[iru];
+    int npix = 0;
+    for (int ic = 0; ic < ru.nChipsFired; ic++) {
+      npix += ru.chipsData[ic].getData().size();
+    }
+    mDigitSliceOffsets[iru + 1] = mDigitSliceOffsets[iru] + npix;
+  }
+  return mDigitSliceOffsets[nru];
+}
+
+///______________________________________________________________________
+/// fill the decoded digits of every RU to its slice of the output
+template <class Mapping>
+void RawPixelDecoder<Mapping>::fillDigitSlices(Digit* digits) const
+{
+  int nru = mRUDecodeVec.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int iru = 0; iru < nru; iru++) {
+    const auto& ru = mRUDecodeVec[iru];
+    auto* digit = digits + mDigitSliceOffsets[iru];
+    for (int ic = 0; ic < ru.nChipsFired; ic++) {
+      const auto& chip = ru.chipsData[ic];
+      for (const auto& hit : chip.getData()) {
+        *digit++ = Digit(chip.getChipID(), hit.getRow(), hit.getCol());
+      }
+    }
+  }
+}
+
+///______________________________________________________________________
+/// define the slices of the chips in the decoded digits of the ROF, return the total number of digits
+template <>
+int RawPixelDecoder<ChipMappingMFT>::prepareDigitSlices()
+{
+  // the chips are ordered in decreasing chipID
+  int nchips = mOrderedChipsPtr.size();
+  mDigitSliceOffsets.resize(nchips + 1);
+  mDigitSliceOffsets[0] = 0;
+  for (int ic = 0; ic < nchips; ic++) {
+    mDigitSliceOffsets[ic + 1] = mDigitSliceOffsets[ic] + mOrderedChipsPtr[nchips - 1 - ic]->getData().size();
+  }
+  return mDigitSliceOffsets[nchips];
+}
+
+///______________________________________________________________________
+/// fill the decoded digits of every chip to its slice of the output
+template <>
+void RawPixelDecoder<ChipMappingMFT>::fillDigitSlices(Digit* digits) const
+{
+  int nchips = mOrderedChipsPtr.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+  for (int ic = 0; ic < nchips; ic++) {
+    const auto& chip = *mOrderedChipsPtr[nchips - 1 - ic];
+    auto* digit = digits + mDigitSliceOffsets[ic];
+    for (const auto& hit : chip.getData()) {
+      *digit++ = Digit(chip.getChipID(), hit.getRow(), hit.getCol());
+    }
+  }
+}
+
 ///______________________________________________________________________
 template <class Mapping>
 void RawPixelDecoder<Mapping>::setVerbosity(int v)
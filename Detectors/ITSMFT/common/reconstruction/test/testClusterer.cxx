@@ -0,0 +1,186 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testClusterer.cxx
+/// \brief Compare the output of the standard and of the column masks clustering kernels
+
+#define BOOST_TEST_MODULE Test ITSMFT Clusterer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "CommonDataFormat/InteractionRecord.h"
+#include "DataFormatsITSMFT/CompCluster.h"
+#include "DataFormatsITSMFT/Digit.h"
+#include "DataFormatsITSMFT/ROFRecord.h"
+#include "ITSMFTBase/SegmentationAlpide.h"
+#include "ITSMFTReconstruction/Clusterer.h"
+#include "ITSMFTReconstruction/DigitPixelReader.h"
+
+using namespace o2::itsmft;
+
+namespace
+{
+
+constexpr int NTestChips = 4;
+constexpr int LastRow = SegmentationAlpide::NRows - 1;
+constexpr int LastCol = SegmentationAlpide::NCols - 1;
+
+void addPixels(std::vector<Digit>& digits, int chip, int col, int rowMin, int rowMax)
+{
+  for (int row = rowMin; row <= rowMax; row++) {
+    digits.emplace_back(chip, row, col, 100);
+  }
+}
+
+/// digits of a few chips, sorted in chip, column and row as the readout provides them
+std::vector<Digit> createDigits()
+{
+  std::vector<Digit> digits;
+  // chip 0: clusters at the chip edges, across the boundaries of the column mask words and of various shapes
+  addPixels(digits, 0, 0, 0, 1); // corner
+  addPixels(digits, 0, 1, 0, 0);
+  addPixels(digits, 0, 0, 200, 203); // 1st column
+  addPixels(digits, 0, LastCol, 300, 302); // last column
+  for (int col = 500; col < 504; col++) { // 1st row
+    addPixels(digits, 0, col, 0, 0);
+  }
+  for (int col = 600; col < 603; col++) { // last row
+    addPixels(digits, 0, col, LastRow, LastRow);
+  }
+  addPixels(digits, 0, LastCol - 1, LastRow, LastRow); // opposite corner
+  addPixels(digits, 0, LastCol, LastRow - 1, LastRow);
+  addPixels(digits, 0, 100, 62, 66); // runs across the mask words boundaries
+  addPixels(digits, 0, 101, 64, 64);
+  addPixels(digits, 0, 102, 127, 128);
+  addPixels(digits, 0, 103, 63, 63);
+  addPixels(digits, 0, 103, 65, 65);
+  addPixels(digits, 0, 104, 0, LastRow); // full column
+  addPixels(digits, 0, 300, 191, 191); // diagonal neighbours only
+  addPixels(digits, 0, 300, 193, 193);
+  addPixels(digits, 0, 301, 192, 192);
+  addPixels(digits, 0, 400, 10, 10); // U shape open towards the previous columns
+  addPixels(digits, 0, 400, 15, 15);
+  addPixels(digits, 0, 401, 10, 15);
+  addPixels(digits, 0, 410, 10, 15); // U shape open towards the next columns
+  addPixels(digits, 0, 411, 10, 10);
+  addPixels(digits, 0, 411, 15, 15);
+  addPixels(digits, 0, 450, 100, 100); // comb joined in the next column
+  addPixels(digits, 0, 450, 102, 102);
+  addPixels(digits, 0, 450, 104, 104);
+  addPixels(digits, 0, 451, 100, 104);
+  addPixels(digits, 0, 460, 100, 100); // adjacent clusters in consecutive columns without common rows
+  addPixels(digits, 0, 461, 102, 103);
+  // chip 1: 2 adjacent pixels
+  addPixels(digits, 1, 700, 255, 256);
+  // chip 2: single pixel, processed by the dedicated fast method by both kernels
+  addPixels(digits, 2, LastCol, LastRow, LastRow);
+  // chip 3: 2x2 clusters covering all rows of a few columns, separated by one row and one column
+  for (int col = 0; col < 96; col += 3) {
+    for (int i = 0; i < 2; i++) {
+      for (int row = 0; row < LastRow; row += 3) {
+        addPixels(digits, 3, col + i, row, row + 1);
+      }
+    }
+  }
+  std::sort(digits.begin(), digits.end(), [](const Digit& a, const Digit& b) {
+    return std::make_tuple(a.getChipIndex(), a.getColumn(), a.getRow()) < std::make_tuple(b.getChipIndex(), b.getColumn(), b.getRow());
+  });
+  return digits;
+}
+
+/// cluster the digits, with standard or column masks kernel
+void findClusters(const std::vector<Digit>& digits, bool columnMasks, CompClusCont& clusters, PatternCont& patterns)
+{
+  std::vector<ROFRecord> rofs;
+  rofs.emplace_back(o2::InteractionRecord(0, 1), 0, 0, digits.size());
+  DigitPixelReader reader;
+  reader.setDigits(digits);
+  reader.setROFRecords(rofs);
+  reader.init();
+  Clusterer clusterer;
+  clusterer.setNChips(NTestChips);
+  clusterer.setMaxBCSeparationToMask(0);
+  clusterer.setColumnMaskClustering(columnMasks);
+  ROFRecCont clusterROFs;
+  clusterer.process(1, reader, &clusters, &patterns, &clusterROFs);
+}
+
+} // namespace
+
+/// \brief Test of the column masks clustering kernel
+/// The same chips are clustered with both kernels, the compact clusters and the patterns have to be identical.
+/// The shapes are chosen such that the single level merging of the preclusters of the standard kernel is exact,
+/// the shapes which need a transitive merging are tested in Clusterer_columnMasksTransitiveMerging.
+BOOST_AUTO_TEST_CASE(Clusterer_columnMasks)
+{
+  auto digits = createDigits();
+
+  CompClusCont clusters, clustersRef;
+  PatternCont patterns, patternsRef;
+  findClusters(digits, false, clustersRef, patternsRef);
+  findClusters(digits, true, clusters, patterns);
+
+  BOOST_CHECK(clustersRef.size() > 20);
+  BOOST_REQUIRE_EQUAL(clusters.size(), clustersRef.size());
+  for (size_t i = 0; i < clusters.size(); i++) {
+    BOOST_CHECK_EQUAL(clusters[i].getChipID(), clustersRef[i].getChipID());
+    BOOST_CHECK_EQUAL(clusters[i].getRow(), clustersRef[i].getRow());
+    BOOST_CHECK_EQUAL(clusters[i].getCol(), clustersRef[i].getCol());
+    BOOST_CHECK_EQUAL(clusters[i].getPatternID(), clustersRef[i].getPatternID());
+  }
+  BOOST_CHECK(patterns == patternsRef);
+}
+
+/// \brief Test of the column masks clustering kernel on a shape needing a transitive merging of the preclusters
+/// The teeth of the comb in the 1st column are joined in the 2nd column, after the lower two were merged, and the
+/// result is joined to the top one in the 3rd column. The column masks kernel must find a single cluster, made of
+/// all the pixels, while the standard kernel splits off the pixel of the lower tooth.
+BOOST_AUTO_TEST_CASE(Clusterer_columnMasksTransitiveMerging)
+{
+  std::vector<std::pair<int, int>> pixels{{0, 0}, {0, 5}, {0, 10}, {1, 0}}; // column, row
+  for (int row = 5; row <= 10; row++) {
+    pixels.emplace_back(1, row);
+  }
+  for (int row = 0; row <= 5; row++) {
+    pixels.emplace_back(2, row);
+  }
+  std::vector<Digit> digits;
+  for (const auto& pix : pixels) {
+    digits.emplace_back(0, pix.second, pix.first, 100);
+  }
+  std::sort(digits.begin(), digits.end(), [](const Digit& a, const Digit& b) {
+    return std::make_tuple(a.getColumn(), a.getRow()) < std::make_tuple(b.getColumn(), b.getRow());
+  });
+
+  CompClusCont clusters;
+  PatternCont patterns;
+  findClusters(digits, true, clusters, patterns);
+
+  BOOST_REQUIRE_EQUAL(clusters.size(), 1);
+  BOOST_CHECK_EQUAL(clusters[0].getRow(), 0);
+  BOOST_CHECK_EQUAL(clusters[0].getCol(), 0);
+  BOOST_CHECK_EQUAL(clusters[0].getPatternID(), CompCluster::InvalidPatternID);
+
+  // the pattern is made of the row and column spans followed by the bits of the fired pixels, row by row
+  const int rowSpan = 11, colSpan = 3;
+  PatternCont expected{rowSpan, colSpan};
+  expected.resize(2 + (rowSpan * colSpan + 7) / 8);
+  for (const auto& pix : pixels) {
+    int nbits = pix.second * colSpan + pix.first;
+    expected[2 + (nbits >> 3)] |= (0x1 << (7 - (nbits % 8)));
+  }
+  BOOST_CHECK(patterns == expected);
+}
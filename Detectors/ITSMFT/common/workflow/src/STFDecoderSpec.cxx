@@ -14,6 +14,7 @@
 /// \author ruben.shahoyan@cern.ch
 
 #include <vector>
+#include <type_traits>
 
 #include "Framework/WorkflowSpec.h"
 #include "Framework/ConfigParamRegistry.h"
@@ -106,6 +107,7 @@ void STFDecoder<Mapping>::init(InitContext& ic)
       nbc += mClusterer->isContinuousReadOut() ? alpParams.roFrameLengthInBC : (alpParams.roFrameLengthTrig / o2::constants::lhc::LHCBunchSpacingNS);
       mClusterer->setMaxBCSeparationToMask(nbc);
       mClusterer->setMaxRowColDiffToMask(clParams.maxRowColDiffToMask);
+      mClusterer->setColumnMaskClustering(clParams.columnMaskClustering);
 
       std::string dictFile = o2::base::NameConf::getAlpideClusterDictionaryFileName(detID, mDictName, "bin");
       if (o2::utils::Str::pathExists(dictFile)) {
@@ -138,29 +140,36 @@ void STFDecoder<Mapping>::run(ProcessingContext& pc)
   std::vector<o2::itsmft::ROFRecord> clusROFVec;
   std::vector<unsigned char> clusPattVec;
 
-  std::vector<Digit> digVec;
-  std::vector<GBTCalibData> calVec;
-  std::vector<ROFRecord> digROFVec;
+  // digits and calibration data are decoded directly to the output buffers, which are shipped w/o copying
+  using DigitsOutput = std::decay_t<decltype(pc.outputs().make<std::vector<Digit>>(Output{orig, "DIGITS", 0, Lifetime::Timeframe}))>;
+  using ROFsOutput = std::decay_t<decltype(pc.outputs().make<std::vector<ROFRecord>>(Output{orig, "DIGITSROF", 0, Lifetime::Timeframe}))>;
+  using CalibOutput = std::decay_t<decltype(pc.outputs().make<std::vector<GBTCalibData>>(Output{orig, "GBTCALIB", 0, Lifetime::Timeframe}))>;
+  DigitsOutput* digVec = nullptr;
+  ROFsOutput* digROFVec = nullptr;
+  CalibOutput* calVec = nullptr;
 
   if (mDoDigits) {
-    digVec.reserve(mEstNDig);
-    digROFVec.reserve(mEstNROF);
+    digVec = &pc.outputs().make<std::vector<Digit>>(Output{orig, "DIGITS", 0, Lifetime::Timeframe});
+    digROFVec = &pc.outputs().make<std::vector<ROFRecord>>(Output{orig, "DIGITSROF", 0, Lifetime::Timeframe});
+    digVec->reserve(mEstNDig);
+    digROFVec->reserve(mEstNROF);
+    if (mDoCalibData) {
+      calVec = &pc.outputs().make<std::vector<GBTCalibData>>(Output{orig, "GBTCALIB", 0, Lifetime::Timeframe});
+      calVec->reserve(mEstNCalib);
+    }
   }
   if (mDoClusters) {
     clusCompVec.reserve(mEstNClus);
     clusROFVec.reserve(mEstNROF);
     clusPattVec.reserve(mEstNClusPatt);
   }
-  if (mDoCalibData) {
-    calVec.reserve(mEstNCalib);
-  }
 
   mDecoder->setDecodeNextAuto(false);
   while (mDecoder->decodeNextTrigger()) {
     if (mDoDigits) {                                    // call before clusterization, since the latter will hide the digits
-      mDecoder->fillDecodedDigits(digVec, digROFVec);   // lot of copying involved
+      mDecoder->fillDecodedDigits(*digVec, *digROFVec); // filled in place
       if (mDoCalibData) {
-        mDecoder->fillCalibData(calVec);
+        mDecoder->fillCalibData(*calVec);
       }
     }
     if (mDoClusters) { // !!! THREADS !!!
@@ -169,13 +178,10 @@ void STFDecoder<Mapping>::run(ProcessingContext& pc)
   }
 
   if (mDoDigits) {
-    pc.outputs().snapshot(Output{orig, "DIGITS", 0, Lifetime::Timeframe}, digVec);
-    pc.outputs().snapshot(Output{orig, "DIGITSROF", 0, Lifetime::Timeframe}, digROFVec);
-    mEstNDig = std::max(mEstNDig, size_t(digVec.size() * 1.2));
-    mEstNROF = std::max(mEstNROF, size_t(digROFVec.size() * 1.2));
+    mEstNDig = std::max(mEstNDig, size_t(digVec->size() * 1.2));
+    mEstNROF = std::max(mEstNROF, size_t(digROFVec->size() * 1.2));
     if (mDoCalibData) {
-      pc.outputs().snapshot(Output{orig, "GBTCALIB", 0, Lifetime::Timeframe}, calVec);
-      mEstNCalib = std::max(mEstNCalib, size_t(calVec.size() * 1.2));
+      mEstNCalib = std::max(mEstNCalib, size_t(calVec->size() * 1.2));
     }
   }
 
@@ -192,7 +198,7 @@ void STFDecoder<Mapping>::run(ProcessingContext& pc)
     LOG(INFO) << mSelfName << " Built " << clusCompVec.size() << " clusters in " << clusROFVec.size() << " ROFs";
   }
   if (mDoDigits) {
-    LOG(INFO) << mSelfName << " Decoded " << digVec.size() << " Digits in " << digROFVec.size() << " ROFs";
+    LOG(INFO) << mSelfName << " Decoded " << digVec->size() << " Digits in " << digROFVec->size() << " ROFs";
   }
   mTimer.Stop();
   auto tfID = DataRefUtils::getHeader<o2::header::DataHeader*>(pc.inputs().getFirstValid(true))->tfCounter;
@@ -18,20 +18,19 @@
 #define ALICEO2_MCH_CLUSTERFINDERORIGINAL_H_
 
 #include <functional>
-#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include <gsl/span>
 
-#include <TH2D.h>
-
 #include "DataFormatsMCH/Digit.h"
 #include "MCHBase/ClusterBlock.h"
 #include "MCHMappingInterface/Segmentation.h"
 #include "MCHPreClustering/PreClusterFinder.h"
 
+class TRandom;
+
 namespace o2
 {
 namespace mch
@@ -40,6 +39,8 @@ namespace mch
 class PadOriginal;
 class ClusterOriginal;
 class MathiesonOriginal;
+template <typename T>
+class PixelGrid;
 
 class ClusterFinderOriginal
 {
@@ -56,6 +57,8 @@ class ClusterFinderOriginal
   void deinit();
   void reset();
 
+  void setRandomSeed(uint32_t seed);
+
   void findClusters(gsl::span<const Digit> digits);
 
   /// return the list of reconstructed clusters
@@ -74,18 +77,18 @@ class ClusterFinderOriginal
   void processPreCluster();
 
   void buildPixArray();
-  void ProjectPadOverPixels(const PadOriginal& pad, TH2D& hCharges, TH2I& hEntries) const;
+  void ProjectPadOverPixels(const PadOriginal& pad, PixelGrid<double>& charges, PixelGrid<int>& entries) const;
 
-  void findLocalMaxima(std::unique_ptr<TH2D>& histAnode, std::multimap<double, std::pair<int, int>, std::greater<>>& localMaxima);
-  void flagLocalMaxima(const TH2D& histAnode, int i0, int j0, std::vector<std::vector<int>>& isLocalMax) const;
-  void restrictPreCluster(const TH2D& histAnode, int i0, int j0);
+  void findLocalMaxima(std::vector<std::pair<int, int>>& localMaxima);
+  void flagLocalMaxima(const PixelGrid<double>& anodes, int i0, int j0, std::vector<std::vector<int>>& isLocalMax) const;
+  void restrictPreCluster(const PixelGrid<double>& anodes, int i0, int j0);
 
   void processSimple();
   void process();
   void addVirtualPad();
   void computeCoefficients(std::vector<double>& coef, std::vector<double>& prob) const;
   double mlem(const std::vector<double>& coef, const std::vector<double>& prob, int nIter);
-  void findCOG(const TH2D& histMLEM, double xy[2]) const;
+  void findCOG(const PixelGrid<double>& pixelsMLEM, double xy[2]) const;
   void refinePixelArray(const double xyCOG[2], size_t nPixMax, double& xMin, double& xMax, double& yMin, double& yMax);
   void cleanPixelArray(double threshold, std::vector<double>& prob);
 
@@ -96,8 +99,8 @@ class ClusterFinderOriginal
   void param2ChargeFraction(const double param[SNFitParamMax], int nParamUsed, double fraction[SNFitClustersMax]) const;
   float chargeIntegration(double x, double y, const PadOriginal& pad) const;
 
-  void split(const TH2D& histMLEM, const std::vector<double>& coef);
-  void addPixel(const TH2D& histMLEM, int i0, int j0, std::vector<int>& pixels, std::vector<std::vector<bool>>& isUsed);
+  void split(const PixelGrid<double>& pixelsMLEM, const std::vector<double>& coef);
+  void addPixel(const PixelGrid<double>& pixelsMLEM, int i0, int j0, std::vector<int>& pixels, std::vector<std::vector<bool>>& isUsed);
   void addCluster(int iCluster, std::vector<int>& coupledClusters, std::vector<bool>& isClUsed,
                   const std::vector<std::vector<double>>& couplingClCl) const;
   void extractLeastCoupledClusters(std::vector<int>& coupledClusters, std::vector<int>& clustersForFit,
@@ -123,12 +126,19 @@ class ClusterFinderOriginal
   std::unique_ptr<ClusterOriginal> mPreCluster; ///< precluster currently processed
   std::vector<PadOriginal> mPixels;             ///< list of pixels for the current precluster
 
+  std::unique_ptr<PixelGrid<double>> mPixelCharges; ///< grid of pixel charges used to build the pixel array
+  std::unique_ptr<PixelGrid<int>> mPixelEntries;    ///< grid of pixel entries used to build the pixel array
+  std::unique_ptr<PixelGrid<double>> mAnodes;       ///< grid of pixels used to find the local maxima
+  std::unique_ptr<PixelGrid<double>> mPixelsMLEM;   ///< grid of pixels after the MLEM procedure
+
   const mapping::Segmentation* mSegmentation = nullptr; ///< pointer to the DE segmentation for the current precluster
 
   std::vector<ClusterStruct> mClusters{}; ///< list of reconstructed clusters
   std::vector<Digit> mUsedDigits{};       ///< list of digits used in reconstructed clusters
 
   PreClusterFinder mPreClusterFinder{}; ///< preclusterizer
+
+  std::unique_ptr<TRandom> mRandom{}; ///< private random generator, gRandom is used if not set
 };
 
 } // namespace mch
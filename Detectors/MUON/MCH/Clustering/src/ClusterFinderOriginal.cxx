@@ -23,15 +23,15 @@
 #include <cstring>
 #include <iterator>
 #include <limits>
+#include <map>
 #include <numeric>
 #include <set>
 #include <stdexcept>
 #include <string>
 
-#include <TH2I.h>
-#include <TAxis.h>
 #include <TMath.h>
 #include <TRandom.h>
+#include <TRandom3.h>
 
 #include <FairMQLogger.h>
 
@@ -39,6 +39,7 @@
 #include "PadOriginal.h"
 #include "ClusterOriginal.h"
 #include "MathiesonOriginal.h"
+#include "PixelGrid.h"
 
 namespace o2
 {
@@ -48,7 +49,11 @@ namespace mch
 //_________________________________________________________________________________________________
 ClusterFinderOriginal::ClusterFinderOriginal()
   : mMathiesons(std::make_unique<MathiesonOriginal[]>(2)),
-    mPreCluster(std::make_unique<ClusterOriginal>())
+    mPreCluster(std::make_unique<ClusterOriginal>()),
+    mPixelCharges(std::make_unique<PixelGrid<double>>()),
+    mPixelEntries(std::make_unique<PixelGrid<int>>()),
+    mAnodes(std::make_unique<PixelGrid<double>>()),
+    mPixelsMLEM(std::make_unique<PixelGrid<double>>())
 {
   /// default constructor
 }
@@ -121,6 +126,18 @@ void ClusterFinderOriginal::reset()
   mUsedDigits.clear();
 }
 
+//_________________________________________________________________________________________________
+void ClusterFinderOriginal::setRandomSeed(uint32_t seed)
+{
+  /// use a private random generator, initialized with the given (non-zero) seed, instead of gRandom
+  /// this makes the results reproducible when several cluster finders run in parallel
+  if (mRandom) {
+    mRandom->SetSeed(seed);
+  } else {
+    mRandom = std::make_unique<TRandom3>(seed);
+  }
+}
+
 //_________________________________________________________________________________________________
 void ClusterFinderOriginal::findClusters(gsl::span<const Digit> digits)
 {
@@ -402,9 +419,8 @@ void ClusterFinderOriginal::processPreCluster()
   } else {
 
     // find the local maxima in the pixel array
-    std::unique_ptr<TH2D> histAnode(nullptr);
-    std::multimap<double, std::pair<int, int>, std::greater<>> localMaxima{};
-    findLocalMaxima(histAnode, localMaxima);
+    std::vector<std::pair<int, int>> localMaxima{};
+    findLocalMaxima(localMaxima);
     if (localMaxima.empty()) {
       return;
     }
@@ -420,7 +436,7 @@ void ClusterFinderOriginal::processPreCluster()
       for (const auto& localMaximum : localMaxima) {
 
         // select the part of the precluster that is around the local maximum
-        restrictPreCluster(*histAnode, localMaximum.second.first, localMaximum.second.second);
+        restrictPreCluster(*mAnodes, localMaximum.first, localMaximum.second);
 
         // treat it
         process();
@@ -490,23 +506,23 @@ void ClusterFinderOriginal::buildPixArray()
     area[ixy][1] = area[ixy][0] + nbins[ixy] * width[ixy] * 2.;
   }
 
-  // book pixel histograms and fill them
-  TH2D hCharges("Charges", "", nbins[0], area[0][0], area[0][1], nbins[1], area[1][0], area[1][1]);
-  TH2I hEntries("Entries", "", nbins[0], area[0][0], area[0][1], nbins[1], area[1][0], area[1][1]);
+  // reset pixel grids and fill them
+  mPixelCharges->reset(nbins[0], area[0][0], area[0][1], nbins[1], area[1][0], area[1][1]);
+  mPixelEntries->reset(nbins[0], area[0][0], area[0][1], nbins[1], area[1][0], area[1][1]);
   for (const auto& pad : *mPreCluster) {
-    ProjectPadOverPixels(pad, hCharges, hEntries);
+    ProjectPadOverPixels(pad, *mPixelCharges, *mPixelEntries);
   }
 
   // store fired pixels with an entry from both planes if both planes are fired
   for (int i = 1; i <= nbins[0]; ++i) {
-    double x = hCharges.GetXaxis()->GetBinCenter(i);
+    double x = mPixelCharges->binCenterX(i);
     for (int j = 1; j <= nbins[1]; ++j) {
-      int entries = hEntries.GetBinContent(i, j);
+      int entries = mPixelEntries->content(i, j);
       if (entries == 0 || (plane0 != plane1 && (entries < 1000 || entries % 1000 < 1))) {
         continue;
       }
-      double y = hCharges.GetYaxis()->GetBinCenter(j);
-      double charge = hCharges.GetBinContent(i, j);
+      double y = mPixelCharges->binCenterY(j);
+      double charge = mPixelCharges->content(i, j);
       mPixels.emplace_back(x, y, width[0], width[1], charge);
     }
   }
@@ -530,39 +546,36 @@ void ClusterFinderOriginal::buildPixArray()
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::ProjectPadOverPixels(const PadOriginal& pad, TH2D& hCharges, TH2I& hEntries) const
+void ClusterFinderOriginal::ProjectPadOverPixels(const PadOriginal& pad, PixelGrid<double>& charges, PixelGrid<int>& entries) const
 {
-  /// project the pad over pixel histograms
-
-  const TAxis* xaxis = hCharges.GetXaxis();
-  const TAxis* yaxis = hCharges.GetYaxis();
+  /// project the pad over pixel grids
 
-  int iMin = TMath::Max(1, xaxis->FindBin(pad.x() - pad.dx() + SDistancePrecision));
-  int iMax = TMath::Min(hCharges.GetNbinsX(), xaxis->FindBin(pad.x() + pad.dx() - SDistancePrecision));
-  int jMin = TMath::Max(1, yaxis->FindBin(pad.y() - pad.dy() + SDistancePrecision));
-  int jMax = TMath::Min(hCharges.GetNbinsY(), yaxis->FindBin(pad.y() + pad.dy() - SDistancePrecision));
+  int iMin = TMath::Max(1, charges.findBinX(pad.x() - pad.dx() + SDistancePrecision));
+  int iMax = TMath::Min(charges.nBinsX(), charges.findBinX(pad.x() + pad.dx() - SDistancePrecision));
+  int jMin = TMath::Max(1, charges.findBinY(pad.y() - pad.dy() + SDistancePrecision));
+  int jMax = TMath::Min(charges.nBinsY(), charges.findBinY(pad.y() + pad.dy() - SDistancePrecision));
 
   double charge = pad.charge();
   int entry = 1 + pad.plane() * 999;
 
   for (int i = iMin; i <= iMax; ++i) {
     for (int j = jMin; j <= jMax; ++j) {
-      int entries = hEntries.GetBinContent(i, j);
-      hCharges.SetBinContent(i, j, (entries > 0) ? TMath::Min(hCharges.GetBinContent(i, j), charge) : charge);
-      hEntries.SetBinContent(i, j, entries + entry);
+      int nEntries = entries.content(i, j);
+      charges.setContent(i, j, (nEntries > 0) ? TMath::Min(charges.content(i, j), charge) : charge);
+      entries.setContent(i, j, nEntries + entry);
     }
   }
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::findLocalMaxima(std::unique_ptr<TH2D>& histAnode,
-                                            std::multimap<double, std::pair<int, int>, std::greater<>>& localMaxima)
+void ClusterFinderOriginal::findLocalMaxima(std::vector<std::pair<int, int>>& localMaxima)
 {
   /// find local maxima in pixel space for large preclusters in order to
   /// try to split them into smaller pieces (to speed up the MLEM procedure)
   /// and tag the corresponding pixels
+  /// the local maxima are sorted by decreasing charge
 
-  // create a 2D histogram from the pixel array
+  // fill a 2D grid from the pixel array
   double xMin(std::numeric_limits<double>::max()), xMax(-std::numeric_limits<double>::max());
   double yMin(std::numeric_limits<double>::max()), yMax(-std::numeric_limits<double>::max());
   double dx(mPixels.front().dx()), dy(mPixels.front().dy());
@@ -574,29 +587,28 @@ void ClusterFinderOriginal::findLocalMaxima(std::unique_ptr<TH2D>& histAnode,
   }
   int nBinsX = TMath::Nint((xMax - xMin) / dx / 2.) + 1;
   int nBinsY = TMath::Nint((yMax - yMin) / dy / 2.) + 1;
-  histAnode = std::make_unique<TH2D>("anode", "anode", nBinsX, xMin - dx, xMax + dx, nBinsY, yMin - dy, yMax + dy);
+  auto& anodes = *mAnodes;
+  anodes.reset(nBinsX, xMin - dx, xMax + dx, nBinsY, yMin - dy, yMax + dy);
   for (const auto& pixel : mPixels) {
-    histAnode->Fill(pixel.x(), pixel.y(), pixel.charge());
+    anodes.fill(pixel.x(), pixel.y(), pixel.charge());
   }
 
   // find the local maxima
   std::vector<std::vector<int>> isLocalMax(nBinsX, std::vector<int>(nBinsY, 0));
   for (int j = 1; j <= nBinsY; ++j) {
     for (int i = 1; i <= nBinsX; ++i) {
-      if (isLocalMax[i - 1][j - 1] == 0 && histAnode->GetBinContent(i, j) >= mLowestPixelCharge) {
-        flagLocalMaxima(*histAnode, i, j, isLocalMax);
+      if (isLocalMax[i - 1][j - 1] == 0 && anodes.content(i, j) >= mLowestPixelCharge) {
+        flagLocalMaxima(anodes, i, j, isLocalMax);
       }
     }
   }
 
   // store local maxima and tag corresponding pixels
-  TAxis* xAxis = histAnode->GetXaxis();
-  TAxis* yAxis = histAnode->GetYaxis();
   for (int j = 1; j <= nBinsY; ++j) {
     for (int i = 1; i <= nBinsX; ++i) {
       if (isLocalMax[i - 1][j - 1] > 0) {
-        localMaxima.emplace(histAnode->GetBinContent(i, j), std::make_pair(i, j));
-        auto itPixel = findPad(mPixels, xAxis->GetBinCenter(i), yAxis->GetBinCenter(j), mLowestPixelCharge);
+        localMaxima.emplace_back(i, j);
+        auto itPixel = findPad(mPixels, anodes.binCenterX(i), anodes.binCenterY(j), mLowestPixelCharge);
         itPixel->setStatus(PadOriginal::kMustKeep);
         if (localMaxima.size() > 99) {
           break;
@@ -608,21 +620,26 @@ void ClusterFinderOriginal::findLocalMaxima(std::unique_ptr<TH2D>& histAnode,
       break;
     }
   }
+
+  // sort them by decreasing charge, keeping the search order in case of equality
+  std::stable_sort(localMaxima.begin(), localMaxima.end(), [&anodes](const auto& max1, const auto& max2) {
+    return anodes.content(max1.first, max1.second) > anodes.content(max2.first, max2.second);
+  });
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::flagLocalMaxima(const TH2D& histAnode, int i0, int j0, std::vector<std::vector<int>>& isLocalMax) const
+void ClusterFinderOriginal::flagLocalMaxima(const PixelGrid<double>& anodes, int i0, int j0, std::vector<std::vector<int>>& isLocalMax) const
 {
   /// flag the bin (i,j) as a local maximum or not by comparing its charge to the one of its neighbours
   /// and flag the neighbours accordingly (recursive procedure in case the charges are equal)
 
   int idxi0 = i0 - 1;
   int idxj0 = j0 - 1;
-  int charge0 = TMath::Nint(histAnode.GetBinContent(i0, j0));
+  int charge0 = TMath::Nint(anodes.content(i0, j0));
   int iMin = TMath::Max(1, i0 - 1);
-  int iMax = TMath::Min(histAnode.GetNbinsX(), i0 + 1);
+  int iMax = TMath::Min(anodes.nBinsX(), i0 + 1);
   int jMin = TMath::Max(1, j0 - 1);
-  int jMax = TMath::Min(histAnode.GetNbinsY(), j0 + 1);
+  int jMax = TMath::Min(anodes.nBinsY(), j0 + 1);
 
   for (int j = jMin; j <= jMax; ++j) {
     int idxj = j - 1;
@@ -631,7 +648,7 @@ void ClusterFinderOriginal::flagLocalMaxima(const TH2D& histAnode, int i0, int j
         continue;
       }
       int idxi = i - 1;
-      int charge = TMath::Nint(histAnode.GetBinContent(i, j));
+      int charge = TMath::Nint(anodes.content(i, j));
       if (charge0 < charge) {
         isLocalMax[idxi0][idxj0] = -1;
         return;
@@ -642,7 +659,7 @@ void ClusterFinderOriginal::flagLocalMaxima(const TH2D& histAnode, int i0, int j
         return;
       } else if (isLocalMax[idxi][idxj] == 0) {
         isLocalMax[idxi0][idxj0] = 1;
-        flagLocalMaxima(histAnode, i, j, isLocalMax);
+        flagLocalMaxima(anodes, i, j, isLocalMax);
         if (isLocalMax[idxi][idxj] == -1) {
           isLocalMax[idxi0][idxj0] = -1;
           return;
@@ -656,27 +673,25 @@ void ClusterFinderOriginal::flagLocalMaxima(const TH2D& histAnode, int i0, int j
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::restrictPreCluster(const TH2D& histAnode, int i0, int j0)
+void ClusterFinderOriginal::restrictPreCluster(const PixelGrid<double>& anodes, int i0, int j0)
 {
   /// keep in the pixel array only the ones around the local maximum
   /// and tag the pads in the precluster that overlap with them
 
   // drop all pixels from the array and put back the ones around the local maximum
   mPixels.clear();
-  const TAxis* xAxis = histAnode.GetXaxis();
-  const TAxis* yAxis = histAnode.GetYaxis();
-  double dx = xAxis->GetBinWidth(1) / 2.;
-  double dy = yAxis->GetBinWidth(1) / 2.;
-  double charge0 = histAnode.GetBinContent(i0, j0);
+  double dx = anodes.binWidthX() / 2.;
+  double dy = anodes.binWidthY() / 2.;
+  double charge0 = anodes.content(i0, j0);
   int iMin = TMath::Max(1, i0 - 1);
-  int iMax = TMath::Min(histAnode.GetNbinsX(), i0 + 1);
+  int iMax = TMath::Min(anodes.nBinsX(), i0 + 1);
   int jMin = TMath::Max(1, j0 - 1);
-  int jMax = TMath::Min(histAnode.GetNbinsY(), j0 + 1);
+  int jMax = TMath::Min(anodes.nBinsY(), j0 + 1);
   for (int j = jMin; j <= jMax; ++j) {
     for (int i = iMin; i <= iMax; ++i) {
-      double charge = histAnode.GetBinContent(i, j);
+      double charge = anodes.content(i, j);
       if (charge >= mLowestPixelCharge && charge <= charge0) {
-        mPixels.emplace_back(xAxis->GetBinCenter(i), yAxis->GetBinCenter(j), dx, dy, charge);
+        mPixels.emplace_back(anodes.binCenterX(i), anodes.binCenterY(j), dx, dy, charge);
       }
     }
   }
@@ -780,7 +795,7 @@ void ClusterFinderOriginal::process()
 
   std::vector<double> coef(0);
   std::vector<double> prob(0);
-  std::unique_ptr<TH2D> histMLEM(nullptr);
+  auto& pixelsMLEM = *mPixelsMLEM;
   while (true) {
 
     // calculate pad-pixel coupling coefficients and pixel visibilities
@@ -801,14 +816,13 @@ void ClusterFinderOriginal::process()
       return;
     }
 
-    // create a 2D histogram from the pixel array
+    // fill a 2D grid from the pixel array
     double dx(mPixels.front().dx()), dy(mPixels.front().dy());
     int nBinsX = TMath::Nint((xMax - xMin) / dx / 2.) + 1;
     int nBinsY = TMath::Nint((yMax - yMin) / dy / 2.) + 1;
-    histMLEM.reset(nullptr); // delete first to avoid "Replacing existing TH1: mlem (Potential memory leak)"
-    histMLEM = std::make_unique<TH2D>("mlem", "mlem", nBinsX, xMin - dx, xMax + dx, nBinsY, yMin - dy, yMax + dy);
+    pixelsMLEM.reset(nBinsX, xMin - dx, xMax + dx, nBinsY, yMin - dy, yMax + dy);
     for (const auto& pixel : mPixels) {
-      histMLEM->Fill(pixel.x(), pixel.y(), pixel.charge());
+      pixelsMLEM.fill(pixel.x(), pixel.y(), pixel.charge());
     }
 
     // stop here if the pixel size is small enough
@@ -818,14 +832,14 @@ void ClusterFinderOriginal::process()
 
     // calculate the position of the center-of-gravity around the pixel with maximum charge
     double xyCOG[2] = {0., 0.};
-    findCOG(*histMLEM, xyCOG);
+    findCOG(pixelsMLEM, xyCOG);
 
     // decrease the pixel size and align the array with the position of the center-of-gravity
     refinePixelArray(xyCOG, npadOK, xMin, xMax, yMin, yMax);
   }
 
   // discard pixels with low visibility by moving their charge to their nearest neighbour (cuts are empirical !!!)
-  double threshold = TMath::Min(TMath::Max(histMLEM->GetMaximum() / 100., 2.0 * mLowestPixelCharge), 100.0 * mLowestPixelCharge);
+  double threshold = TMath::Min(TMath::Max(pixelsMLEM.maximum() / 100., 2.0 * mLowestPixelCharge), 100.0 * mLowestPixelCharge);
   cleanPixelArray(threshold, prob);
 
   // re-run the MLEM algorithm with 2 iterations
@@ -836,13 +850,13 @@ void ClusterFinderOriginal::process()
     return;
   }
 
-  // update the histogram
+  // update the grid
   for (const auto& pixel : mPixels) {
-    histMLEM->SetBinContent(histMLEM->GetXaxis()->FindBin(pixel.x()), histMLEM->GetYaxis()->FindBin(pixel.y()), pixel.charge());
+    pixelsMLEM.setContent(pixelsMLEM.findBinX(pixel.x()), pixelsMLEM.findBinY(pixel.y()), pixel.charge());
   }
 
   // split the precluster into clusters
-  split(*histMLEM, coef);
+  split(pixelsMLEM, coef);
 }
 
 //_________________________________________________________________________________________________
@@ -959,22 +973,41 @@ void ClusterFinderOriginal::computeCoefficients(std::vector<double>& coef, std::
 {
   /// Compute pad-pixel coupling coefficients and pixel visibilities needed for the MLEM algorithm
 
-  coef.assign(mPreCluster->multiplicity() * mPixels.size(), 0.);
-  prob.assign(mPixels.size(), 0.);
+  int nPixels = mPixels.size();
+  coef.assign(mPreCluster->multiplicity() * nPixels, 0.);
+  prob.assign(nPixels, 0.);
+
+  // integration limits of the pad relative to every pixel and corresponding charges, in contiguous arrays
+  std::vector<float> limits(4 * nPixels);
+  float* xMin = limits.data();
+  float* yMin = xMin + nPixels;
+  float* xMax = yMin + nPixels;
+  float* yMax = xMax + nPixels;
+  std::vector<float> charges(nPixels);
 
   int iCoef(0);
   for (const auto& pad : *mPreCluster) {
 
     // ignore the pads that must not be considered
     if (pad.status() != PadOriginal::kZero) {
-      iCoef += mPixels.size();
+      iCoef += nPixels;
       continue;
     }
 
-    for (int i = 0; i < mPixels.size(); ++i) {
+    // charge (given by Mathieson integral) on pad, assuming the Mathieson is center at pixel.
+    for (int i = 0; i < nPixels; ++i) {
+      double xPad = pad.x() - mPixels[i].x();
+      double yPad = pad.y() - mPixels[i].y();
+      xMin[i] = xPad - pad.dx();
+      yMin[i] = yPad - pad.dy();
+      xMax[i] = xPad + pad.dx();
+      yMax[i] = yPad + pad.dy();
+    }
+    mMathieson->integrate(nPixels, xMin, yMin, xMax, yMax, charges.data());
+
+    for (int i = 0; i < nPixels; ++i) {
 
-      // charge (given by Mathieson integral) on pad, assuming the Mathieson is center at pixel.
-      coef[iCoef] = chargeIntegration(mPixels[i].x(), mPixels[i].y(), pad);
+      coef[iCoef] = charges[i];
 
       // update the pixel visibility
       prob[i] += coef[iCoef];
@@ -1060,29 +1093,28 @@ double ClusterFinderOriginal::mlem(const std::vector<double>& coef, const std::v
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::findCOG(const TH2D& histMLEM, double xy[2]) const
+void ClusterFinderOriginal::findCOG(const PixelGrid<double>& pixelsMLEM, double xy[2]) const
 {
   /// calculate the position of the center-of-gravity around the pixel with maximum charge
 
   // define the range of pixels and the minimum charge to consider
-  int ix0(0), iy0(0), iz0(0);
-  double chargeThreshold = histMLEM.GetBinContent(histMLEM.GetMaximumBin(ix0, iy0, iz0)) / 10.;
+  int ix0(0), iy0(0);
+  pixelsMLEM.maximumBin(ix0, iy0);
+  double chargeThreshold = pixelsMLEM.content(ix0, iy0) / 10.;
   int ixMin = TMath::Max(1, ix0 - 1);
-  int ixMax = TMath::Min(histMLEM.GetNbinsX(), ix0 + 1);
+  int ixMax = TMath::Min(pixelsMLEM.nBinsX(), ix0 + 1);
   int iyMin = TMath::Max(1, iy0 - 1);
-  int iyMax = TMath::Min(histMLEM.GetNbinsY(), iy0 + 1);
+  int iyMax = TMath::Min(pixelsMLEM.nBinsY(), iy0 + 1);
 
   // first only consider pixels above threshold
-  const TAxis* xAxis = histMLEM.GetXaxis();
-  const TAxis* yAxis = histMLEM.GetYaxis();
   double xq(0.), yq(0.), q(0.);
   bool onePixelWidthX(true), onePixelWidthY(true);
   for (int iy = iyMin; iy <= iyMax; ++iy) {
     for (int ix = ixMin; ix <= ixMax; ++ix) {
-      double charge = histMLEM.GetBinContent(ix, iy);
+      double charge = pixelsMLEM.content(ix, iy);
       if (charge >= chargeThreshold) {
-        xq += xAxis->GetBinCenter(ix) * charge;
-        yq += yAxis->GetBinCenter(iy) * charge;
+        xq += pixelsMLEM.binCenterX(ix) * charge;
+        yq += pixelsMLEM.binCenterY(iy) * charge;
         q += charge;
         if (ix != ix0) {
           onePixelWidthX = false;
@@ -1101,10 +1133,10 @@ void ClusterFinderOriginal::findCOG(const TH2D& histMLEM, double xy[2]) const
     for (int iy = iyMin; iy <= iyMax; ++iy) {
       if (iy != iy0) {
         for (int ix = ixMin; ix <= ixMax; ++ix) {
-          double charge = histMLEM.GetBinContent(ix, iy);
+          double charge = pixelsMLEM.content(ix, iy);
           if (charge > chargePixel) {
-            xPixel = xAxis->GetBinCenter(ix);
-            yPixel = yAxis->GetBinCenter(iy);
+            xPixel = pixelsMLEM.binCenterX(ix);
+            yPixel = pixelsMLEM.binCenterY(iy);
             chargePixel = charge;
             ixPixel = ix;
           }
@@ -1125,10 +1157,10 @@ void ClusterFinderOriginal::findCOG(const TH2D& histMLEM, double xy[2]) const
     for (int ix = ixMin; ix <= ixMax; ++ix) {
       if (ix != ix0) {
         for (int iy = iyMin; iy <= iyMax; ++iy) {
-          double charge = histMLEM.GetBinContent(ix, iy);
+          double charge = pixelsMLEM.content(ix, iy);
           if (charge > chargePixel) {
-            xPixel = xAxis->GetBinCenter(ix);
-            yPixel = yAxis->GetBinCenter(iy);
+            xPixel = pixelsMLEM.binCenterX(ix);
+            yPixel = pixelsMLEM.binCenterY(iy);
             chargePixel = charge;
           }
         }
@@ -1620,7 +1652,7 @@ double ClusterFinderOriginal::fit(double currentParam[SNFitParamMax + 2],
       }
       if (nFail > 10) {
         currentParam[iDerivMax] -= shift[iDerivMax];
-        shift[iDerivMax] = 4. * shiftSave * (gRandom->Rndm(0) - 0.5);
+        shift[iDerivMax] = 4. * shiftSave * ((mRandom ? mRandom.get() : gRandom)->Rndm(0) - 0.5);
         currentParam[iDerivMax] += shift[iDerivMax];
       }
     }
@@ -1696,7 +1728,7 @@ float ClusterFinderOriginal::chargeIntegration(double x, double y, const PadOrig
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::split(const TH2D& histMLEM, const std::vector<double>& coef)
+void ClusterFinderOriginal::split(const PixelGrid<double>& pixelsMLEM, const std::vector<double>& coef)
 {
   /// group the pixels in clusters then group together the clusters coupled to the same pads,
   /// split them into sub-groups if they are too many, merge them if they are not coupled to enough pads
@@ -1710,16 +1742,16 @@ void ClusterFinderOriginal::split(const TH2D& histMLEM, const std::vector<double
   }
 
   // find clusters of pixels
-  int nBinsX = histMLEM.GetNbinsX();
-  int nBinsY = histMLEM.GetNbinsY();
+  int nBinsX = pixelsMLEM.nBinsX();
+  int nBinsY = pixelsMLEM.nBinsY();
   std::vector<std::vector<int>> clustersOfPixels{};
   std::vector<std::vector<bool>> isUsed(nBinsX, std::vector<bool>(nBinsY, false));
   for (int j = 1; j <= nBinsY; ++j) {
     for (int i = 1; i <= nBinsX; ++i) {
-      if (!isUsed[i - 1][j - 1] && histMLEM.GetBinContent(i, j) >= mLowestPixelCharge) {
+      if (!isUsed[i - 1][j - 1] && pixelsMLEM.content(i, j) >= mLowestPixelCharge) {
         // add a new cluster of pixels and the associated pixels recursively
         clustersOfPixels.emplace_back();
-        addPixel(histMLEM, i, j, clustersOfPixels.back(), isUsed);
+        addPixel(pixelsMLEM, i, j, clustersOfPixels.back(), isUsed);
       }
     }
   }
@@ -1762,10 +1794,8 @@ void ClusterFinderOriginal::split(const TH2D& histMLEM, const std::vector<double
   }
 
   // define the fit range
-  const TAxis* xAxis = histMLEM.GetXaxis();
-  const TAxis* yAxis = histMLEM.GetYaxis();
-  double fitRange[2][2] = {{xAxis->GetXmin() - xAxis->GetBinWidth(1), xAxis->GetXmax() + xAxis->GetBinWidth(1)},
-                           {yAxis->GetXmin() - yAxis->GetBinWidth(1), yAxis->GetXmax() + yAxis->GetBinWidth(1)}};
+  double fitRange[2][2] = {{pixelsMLEM.xMin() - pixelsMLEM.binWidthX(), pixelsMLEM.xMax() + pixelsMLEM.binWidthX()},
+                           {pixelsMLEM.yMin() - pixelsMLEM.binWidthY(), pixelsMLEM.yMax() + pixelsMLEM.binWidthY()}};
 
   std::vector<bool> isClUsed(clustersOfPixels.size(), false);
   std::vector<int> coupledClusters{};
@@ -1831,23 +1861,23 @@ void ClusterFinderOriginal::split(const TH2D& histMLEM, const std::vector<double
 }
 
 //_________________________________________________________________________________________________
-void ClusterFinderOriginal::addPixel(const TH2D& histMLEM, int i0, int j0, std::vector<int>& pixels, std::vector<std::vector<bool>>& isUsed)
+void ClusterFinderOriginal::addPixel(const PixelGrid<double>& pixelsMLEM, int i0, int j0, std::vector<int>& pixels, std::vector<std::vector<bool>>& isUsed)
 {
   /// add a pixel to the cluster of pixels then add recursively its neighbours,
   /// if their charge is higher than mLowestPixelCharge and excluding corners
 
-  auto itPixel = findPad(mPixels, histMLEM.GetXaxis()->GetBinCenter(i0), histMLEM.GetYaxis()->GetBinCenter(j0), mLowestPixelCharge);
+  auto itPixel = findPad(mPixels, pixelsMLEM.binCenterX(i0), pixelsMLEM.binCenterY(j0), mLowestPixelCharge);
   pixels.push_back(std::distance(mPixels.begin(), itPixel));
   isUsed[i0 - 1][j0 - 1] = true;
 
   int iMin = TMath::Max(1, i0 - 1);
-  int iMax = TMath::Min(histMLEM.GetNbinsX(), i0 + 1);
+  int iMax = TMath::Min(pixelsMLEM.nBinsX(), i0 + 1);
   int jMin = TMath::Max(1, j0 - 1);
-  int jMax = TMath::Min(histMLEM.GetNbinsY(), j0 + 1);
+  int jMax = TMath::Min(pixelsMLEM.nBinsY(), j0 + 1);
   for (int j = jMin; j <= jMax; ++j) {
     for (int i = iMin; i <= iMax; ++i) {
-      if (!isUsed[i - 1][j - 1] && (i == i0 || j == j0) && histMLEM.GetBinContent(i, j) >= mLowestPixelCharge) {
-        addPixel(histMLEM, i, j, pixels, isUsed);
+      if (!isUsed[i - 1][j - 1] && (i == i0 || j == j0) && pixelsMLEM.content(i, j) >= mLowestPixelCharge) {
+        addPixel(pixelsMLEM, i, j, pixels, isUsed);
       }
     }
   }
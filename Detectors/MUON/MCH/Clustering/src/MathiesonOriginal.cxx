@@ -66,5 +66,14 @@ float MathiesonOriginal::integrate(float xMin, float yMin, float xMax, float yMa
                             mKy4 * (TMath::ATan(uyMax) - TMath::ATan(uyMin)));
 }
 
+//_________________________________________________________________________________________________
+void MathiesonOriginal::integrate(int n, const float* xMin, const float* yMin, const float* xMax, const float* yMax, float* integrals) const
+{
+  /// integrate the Mathieson over x and y in the n given areas, stored in contiguous arrays
+  for (int i = 0; i < n; ++i) {
+    integrals[i] = integrate(xMin[i], yMin[i], xMax[i], yMax[i]);
+  }
+}
+
 } // namespace mch
 } // namespace o2
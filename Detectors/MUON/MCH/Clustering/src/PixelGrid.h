@@ -0,0 +1,144 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file PixelGrid.h
+/// \brief Definition of the pixel grid used by the original cluster finder algorithm
+///
+/// The grid replaces the TH2 histograms used in the original code. The binning and the
+/// bin numbering (1..n, with 0 and n+1 for underflow and overflow) follow the ones of
+/// the ROOT histograms with fixed bins, so that the results are unchanged.
+
+#ifndef ALICEO2_MCH_PIXELGRID_H_
+#define ALICEO2_MCH_PIXELGRID_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace o2
+{
+namespace mch
+{
+
+/// regular 2D grid of pixels stored in a contiguous buffer, reused from one precluster to the next
+template <typename T>
+class PixelGrid
+{
+ public:
+  PixelGrid() = default;
+  ~PixelGrid() = default;
+
+  PixelGrid(const PixelGrid&) = default;
+  PixelGrid& operator=(const PixelGrid&) = default;
+  PixelGrid(PixelGrid&&) = default;
+  PixelGrid& operator=(PixelGrid&&) = default;
+
+  /// define the binning and reset the content, keeping the memory already allocated
+  void reset(int nBinsX, double xMin, double xMax, int nBinsY, double yMin, double yMax)
+  {
+    mAxes[0] = {nBinsX, xMin, xMax};
+    mAxes[1] = {nBinsY, yMin, yMax};
+    mContents.assign((nBinsX + 2) * (nBinsY + 2), T(0));
+  }
+
+  /// return the number of bins in x
+  int nBinsX() const { return mAxes[0].nBins; }
+  /// return the number of bins in y
+  int nBinsY() const { return mAxes[1].nBins; }
+
+  /// return the lower edge of the grid in x
+  double xMin() const { return mAxes[0].min; }
+  /// return the upper edge of the grid in x
+  double xMax() const { return mAxes[0].max; }
+  /// return the lower edge of the grid in y
+  double yMin() const { return mAxes[1].min; }
+  /// return the upper edge of the grid in y
+  double yMax() const { return mAxes[1].max; }
+
+  /// return the bin width in x
+  double binWidthX() const { return mAxes[0].binWidth(); }
+  /// return the bin width in y
+  double binWidthY() const { return mAxes[1].binWidth(); }
+
+  /// return the bin center in x
+  double binCenterX(int i) const { return mAxes[0].binCenter(i); }
+  /// return the bin center in y
+  double binCenterY(int j) const { return mAxes[1].binCenter(j); }
+
+  /// return the bin containing x
+  int findBinX(double x) const { return mAxes[0].findBin(x); }
+  /// return the bin containing y
+  int findBinY(double y) const { return mAxes[1].findBin(y); }
+
+  /// return the content of the bin (i,j)
+  T content(int i, int j) const { return mContents[index(i, j)]; }
+  /// set the content of the bin (i,j)
+  void setContent(int i, int j, T content) { mContents[index(i, j)] = content; }
+  /// add the weight w to the bin containing (x,y)
+  void fill(double x, double y, T w) { mContents[index(findBinX(x), findBinY(y))] += w; }
+
+  /// return the maximum content, excluding underflows and overflows
+  T maximum() const
+  {
+    int i(0), j(0);
+    maximumBin(i, j);
+    return content(i, j);
+  }
+
+  /// find the bin (i,j) with the maximum content, excluding underflows and overflows,
+  /// taking the first one in case of equality (scanning x first)
+  void maximumBin(int& i0, int& j0) const
+  {
+    i0 = j0 = 0;
+    T max = std::numeric_limits<T>::lowest();
+    for (int j = 1; j <= nBinsY(); ++j) {
+      const T* row = &mContents[index(0, j)];
+      for (int i = 1; i <= nBinsX(); ++i) {
+        if (row[i] > max) {
+          max = row[i];
+          i0 = i;
+          j0 = j;
+        }
+      }
+    }
+  }
+
+ private:
+  /// fixed binning along one direction
+  struct Axis {
+    int nBins = 0;
+    double min = 0.;
+    double max = 0.;
+
+    double binWidth() const { return (max - min) / nBins; }
+    double binCenter(int bin) const { return min + (bin - 1) * binWidth() + 0.5 * binWidth(); }
+    int findBin(double x) const
+    {
+      if (x < min) {
+        return 0;
+      } else if (!(x < max)) {
+        return nBins + 1;
+      }
+      return 1 + static_cast<int>(nBins * (x - min) / (max - min));
+    }
+  };
+
+  /// return the index of the bin (i,j) in the buffer
+  int index(int i, int j) const { return i + (nBinsX() + 2) * j; }
+
+  Axis mAxes[2]{};          ///< binning in x and y
+  std::vector<T> mContents; ///< bin contents, including underflows and overflows
+};
+
+} // namespace mch
+} // namespace o2
+
+#endif // ALICEO2_MCH_PIXELGRID_H_
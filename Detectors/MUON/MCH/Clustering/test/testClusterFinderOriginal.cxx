@@ -0,0 +1,155 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testClusterFinderOriginal.cxx
+/// \brief Test the reproducibility of the clustering of preclusters processed in parallel
+
+#define BOOST_TEST_MODULE Test MCH ClusterFinderOriginal
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gsl/span>
+
+#include "MCHBase/ClusterBlock.h"
+#include "DataFormatsMCH/Digit.h"
+#include "MCHClustering/ClusterFinderOriginal.h"
+#include "MCHMappingInterface/Segmentation.h"
+
+using namespace o2::mch;
+
+namespace
+{
+
+/// clusters and attached digits found in one precluster
+struct PreClusterResult {
+  std::vector<ClusterStruct> clusters{};
+  std::vector<Digit> usedDigits{};
+};
+
+/// digits of a precluster made of two close-by Mathieson-like charge distributions, on both cathodes
+std::vector<Digit> createPreCluster(int deId, double x, double y, double distance)
+{
+  const auto& segmentation = mapping::segmentation(deId);
+  std::vector<Digit> digits{};
+  segmentation.forEachPadInArea(x - 2., y - 2., x + distance + 2., y + 2., [&](int padId) {
+    double charge(0.);
+    for (auto xc : {x, x + distance}) {
+      double dx = segmentation.padPositionX(padId) - xc;
+      double dy = segmentation.padPositionY(padId) - y;
+      charge += 500. * std::exp(-(dx * dx + dy * dy) / 0.5);
+    }
+    if (charge > 5.) {
+      digits.emplace_back(deId, padId, static_cast<uint32_t>(charge), 0);
+    }
+  });
+  return digits;
+}
+
+/// a few preclusters with overlapping clusters on a station 1 and a station 3 detection elements
+std::vector<std::vector<Digit>> createPreClusters()
+{
+  std::vector<std::vector<Digit>> preClusters{};
+  for (int i = 0; i < 8; ++i) {
+    preClusters.emplace_back(createPreCluster(100, 20. + 8. * i, 30., 0.4 + 0.1 * i));
+    preClusters.emplace_back(createPreCluster(500, -30. + 8. * i, 0., 1. + 0.2 * i));
+  }
+  return preClusters;
+}
+
+/// clusterize the preclusters one after the other with the same cluster finder, as in sequential mode
+std::vector<PreClusterResult> findClustersSequentially(const std::vector<std::vector<Digit>>& preClusters)
+{
+  ClusterFinderOriginal clusterFinder{};
+  clusterFinder.init(false);
+  std::vector<PreClusterResult> results(preClusters.size());
+  for (int i = 0; i < preClusters.size(); ++i) {
+    clusterFinder.reset();
+    clusterFinder.setRandomSeed(i + 1);
+    clusterFinder.findClusters(preClusters[i]);
+    results[i].clusters = clusterFinder.getClusters();
+    results[i].usedDigits = clusterFinder.getUsedDigits();
+  }
+  clusterFinder.deinit();
+  return results;
+}
+
+/// clusterize the preclusters with one cluster finder per thread, each thread processing its preclusters
+/// in reverse order, so that every cluster finder sees a different history than in sequential mode
+std::vector<PreClusterResult> findClustersInParallel(const std::vector<std::vector<Digit>>& preClusters, int nThreads)
+{
+  std::vector<PreClusterResult> results(preClusters.size());
+  std::vector<std::thread> threads{};
+  for (int iThread = 0; iThread < nThreads; ++iThread) {
+    threads.emplace_back([&preClusters, &results, iThread, nThreads]() {
+      ClusterFinderOriginal clusterFinder{};
+      clusterFinder.init(false);
+      for (int i = preClusters.size() - 1; i >= 0; --i) {
+        if (i % nThreads != iThread) {
+          continue;
+        }
+        clusterFinder.reset();
+        clusterFinder.setRandomSeed(i + 1);
+        clusterFinder.findClusters(preClusters[i]);
+        results[i].clusters = clusterFinder.getClusters();
+        results[i].usedDigits = clusterFinder.getUsedDigits();
+      }
+      clusterFinder.deinit();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return results;
+}
+
+} // namespace
+
+BOOST_DATA_TEST_CASE(ClusteringDoesNotDependOnTheNumberOfThreads, boost::unit_test::data::make({2, 3, 4}), nThreads)
+{
+  auto preClusters = createPreClusters();
+  auto reference = findClustersSequentially(preClusters);
+  auto results = findClustersInParallel(preClusters, nThreads);
+
+  int nClusters(0);
+  for (int i = 0; i < preClusters.size(); ++i) {
+    const auto& clusters = results[i].clusters;
+    const auto& refClusters = reference[i].clusters;
+    BOOST_REQUIRE_EQUAL(clusters.size(), refClusters.size());
+    for (int iCluster = 0; iCluster < clusters.size(); ++iCluster) {
+      BOOST_CHECK_EQUAL(clusters[iCluster].x, refClusters[iCluster].x);
+      BOOST_CHECK_EQUAL(clusters[iCluster].y, refClusters[iCluster].y);
+      BOOST_CHECK_EQUAL(clusters[iCluster].ex, refClusters[iCluster].ex);
+      BOOST_CHECK_EQUAL(clusters[iCluster].ey, refClusters[iCluster].ey);
+      BOOST_CHECK_EQUAL(clusters[iCluster].uid, refClusters[iCluster].uid);
+      BOOST_CHECK_EQUAL(clusters[iCluster].firstDigit, refClusters[iCluster].firstDigit);
+      BOOST_CHECK_EQUAL(clusters[iCluster].nDigits, refClusters[iCluster].nDigits);
+    }
+    nClusters += clusters.size();
+    const auto& usedDigits = results[i].usedDigits;
+    const auto& refUsedDigits = reference[i].usedDigits;
+    BOOST_REQUIRE_EQUAL(usedDigits.size(), refUsedDigits.size());
+    for (int iDigit = 0; iDigit < usedDigits.size(); ++iDigit) {
+      BOOST_CHECK_EQUAL(usedDigits[iDigit].getPadID(), refUsedDigits[iDigit].getPadID());
+      BOOST_CHECK_EQUAL(usedDigits[iDigit].getADC(), refUsedDigits[iDigit].getADC());
+    }
+  }
+
+  // make sure the test is not trivially passing
+  BOOST_CHECK_GT(nClusters, preClusters.size());
+}
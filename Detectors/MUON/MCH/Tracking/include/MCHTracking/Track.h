@@ -37,8 +37,8 @@ class Track
 
   Track(const Track& track);
   Track& operator=(const Track& track) = delete;
-  Track(Track&&) = delete;
-  Track& operator=(Track&&) = delete;
+  Track(Track&&) = default;
+  Track& operator=(Track&&) = default;
 
   /// Return the number of attached clusters
   int getNClusters() const { return mParamAtClusters.size(); }
@@ -20,14 +20,18 @@
 #include <chrono>
 #include <unordered_map>
 #include <unordered_set>
-#include <list>
+#include <memory>
 #include <array>
 #include <vector>
 #include <utility>
 
+#include <gsl/span>
+
+#include "MCHBase/ClusterBlock.h"
 #include "MCHTracking/Cluster.h"
 #include "MCHTracking/Track.h"
 #include "MCHTracking/TrackFitter.h"
+#include "MCHTracking/TrackList.h"
 
 namespace o2
 {
@@ -46,9 +50,9 @@ class TrackFinder
   TrackFinder(TrackFinder&&) = delete;
   TrackFinder& operator=(TrackFinder&&) = delete;
 
-  void init(float l3Current, float dipoleCurrent);
+  void init(float l3Current, float dipoleCurrent, int nThreads = 1);
 
-  const std::list<Track>& findTracks(const std::unordered_map<int, std::list<Cluster>>& clusters);
+  const TrackList& findTracks(gsl::span<const ClusterStruct> clusters);
 
   /// set the debug level defining the verbosity
   void debug(int debugLevel) { mDebugLevel = debugLevel; }
@@ -61,18 +65,21 @@ class TrackFinder
   void findTrackCandidatesInSt5();
   void findTrackCandidatesInSt4();
   void findMoreTrackCandidates();
-  std::list<Track>::iterator findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const std::list<Track>::iterator& itFirstTrack);
-
-  std::list<Track>::iterator followTrackInOverlapDE(const std::list<Track>::iterator& itTrack, int currentDE, int plane);
-  std::list<Track>::iterator followTrackInChamber(std::list<Track>::iterator& itTrack,
-                                                  int chamber, int lastChamber, bool canSkip,
-                                                  std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
-  std::list<Track>::iterator followTrackInChamber(std::list<Track>::iterator& itTrack,
-                                                  int plane1, int plane2, int lastChamber,
-                                                  std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
-  std::list<Track>::iterator addClustersAndFollowTrack(std::list<Track>::iterator& itTrack, const TrackParam& paramAtCluster1,
-                                                       const TrackParam* paramAtCluster2, int nextChamber, int lastChamber,
-                                                       std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
+  TrackList::iterator findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const TrackList::iterator& itFirstTrack);
+
+  void followTracks();
+  void followTracksInParallel();
+
+  TrackList::iterator followTrackInOverlapDE(const TrackList::iterator& itTrack, int currentDE, int plane);
+  TrackList::iterator followTrackInChamber(TrackList::iterator& itTrack,
+                                           int chamber, int lastChamber, bool canSkip,
+                                           std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
+  TrackList::iterator followTrackInChamber(TrackList::iterator& itTrack,
+                                           int plane1, int plane2, int lastChamber,
+                                           std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
+  TrackList::iterator addClustersAndFollowTrack(TrackList::iterator& itTrack, const TrackParam& paramAtCluster1,
+                                                const TrackParam* paramAtCluster2, int nextChamber, int lastChamber,
+                                                std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters);
 
   void improveTracks();
 
@@ -86,15 +93,15 @@ class TrackFinder
 
   bool isAcceptable(const TrackParam& param) const;
 
-  void prepareForwardTracking(std::list<Track>::iterator& itTrack, bool runSmoother);
-  void prepareBackwardTracking(std::list<Track>::iterator& itTrack, bool refit);
+  void prepareForwardTracking(TrackList::iterator& itTrack, bool runSmoother);
+  void prepareBackwardTracking(TrackList::iterator& itTrack, bool refit);
   void setCurrentParam(Track& track, const TrackParam& param, int chamber, bool smoothed = false);
   bool propagateCurrentParam(Track& track, int chamber);
 
-  bool areUsed(const Cluster& cl1, const Cluster& cl2, const std::list<Track>::iterator& itFirstTrack, const std::list<Track>::iterator& itLastTrack);
-  void excludeClustersFromIdenticalTracks(const std::list<Track>::iterator& itTrack,
+  bool areUsed(const Cluster& cl1, const Cluster& cl2, const TrackList::iterator& itFirstTrack, const TrackList::iterator& itLastTrack);
+  void excludeClustersFromIdenticalTracks(const TrackList::iterator& itTrack,
                                           std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters,
-                                          const std::list<Track>::iterator& itEndTrack);
+                                          const TrackList::iterator& itEndTrack);
   void moveClusters(std::unordered_map<int, std::unordered_set<uint32_t>>& source, std::unordered_map<int, std::unordered_set<uint32_t>>& destination);
 
   bool isCompatible(const TrackParam& param, const Cluster& cluster, TrackParam& paramAtCluster);
@@ -103,7 +110,7 @@ class TrackFinder
 
   uint8_t requestedStationMask() const;
 
-  int getTrackIndex(const std::list<Track>::iterator& itCurrentTrack) const;
+  int getTrackIndex(const TrackList::iterator& itCurrentTrack) const;
   void printTracks() const;
   void printTrack(const Track& track) const;
   void printTrackParam(const TrackParam& trackParam) const;
@@ -128,9 +135,16 @@ class TrackFinder
 
   TrackFitter mTrackFitter{}; /// track fitter
 
-  std::array<std::vector<std::pair<const int, const std::list<Cluster>*>>, 32> mClusters{}; ///< array of pointers to the lists of clusters per DE
+  static constexpr int SNDEIds = 2048; ///< size of the range of DE IDs that can be encoded in the cluster unique ID
+
+  std::vector<Cluster> mClusterStore{};              ///< clusters of the current event, stored contiguously per DE
+  std::array<int, SNDEIds + 1> mDEClusterOffsets{}; ///< index in mClusterStore of the 1st cluster of every DE
+  std::array<std::vector<std::pair<const int, gsl::span<const Cluster>>>, 32> mClusters{}; ///< array of clusters per DE in mClusterStore
+
+  TrackList mTracks{}; ///< list of reconstructed tracks
 
-  std::list<Track> mTracks{}; ///< list of reconstructed tracks
+  /// track finders following the candidates in parallel, one per thread, sharing the clusters of this one
+  std::vector<std::unique_ptr<TrackFinder>> mWorkers{};
 
   double mChamberResolutionX2 = 0.;      ///< chamber resolution square (cm^2) in x direction
   double mChamberResolutionY2 = 0.;      ///< chamber resolution square (cm^2) in y direction
@@ -0,0 +1,234 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file TrackList.h
+/// \brief Definition of a list of tracks stored in a vector and linked by indices
+
+#ifndef ALICEO2_MCH_TRACKLIST_H_
+#define ALICEO2_MCH_TRACKLIST_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MCHTracking/Track.h"
+
+namespace o2
+{
+namespace mch
+{
+
+/// Doubly-linked list of tracks, stored in a vector and linked by indices.
+/// Like with a std::list, the iterators remain valid when other tracks are inserted or erased,
+/// but the tracks are not allocated one by one and the storage is reused from one event to the next.
+class TrackList
+{
+ public:
+  static constexpr int End = -1; ///< index of the position after the last track
+
+  /// bidirectional iterator over the tracks, in the list order
+  template <bool IsConst>
+  class Iterator
+  {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Track;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const Track*, Track*>;
+    using reference = std::conditional_t<IsConst, const Track&, Track&>;
+    using List = std::conditional_t<IsConst, const TrackList, TrackList>;
+
+    Iterator() = default;
+    Iterator(List* list, int index) : mList(list), mIndex(index) {}
+    /// conversion from iterator to const_iterator
+    template <bool C = IsConst, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false>& other) : mList(other.mList), mIndex(other.mIndex)
+    {
+    }
+
+    reference operator*() const { return mList->mTracks[mIndex]; }
+    pointer operator->() const { return &mList->mTracks[mIndex]; }
+
+    Iterator& operator++()
+    {
+      mIndex = mList->mNext[mIndex];
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      auto it = *this;
+      ++(*this);
+      return it;
+    }
+    Iterator& operator--()
+    {
+      mIndex = (mIndex == End) ? mList->mLast : mList->mPrev[mIndex];
+      return *this;
+    }
+    Iterator operator--(int)
+    {
+      auto it = *this;
+      --(*this);
+      return it;
+    }
+
+    template <bool C>
+    bool operator==(const Iterator<C>& other) const
+    {
+      return mIndex == other.mIndex;
+    }
+    template <bool C>
+    bool operator!=(const Iterator<C>& other) const
+    {
+      return mIndex != other.mIndex;
+    }
+
+   private:
+    friend class TrackList;
+    friend class Iterator<!IsConst>;
+
+    List* mList = nullptr; ///< list the iterator belongs to
+    int mIndex = End;      ///< index of the track in the storage
+  };
+
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  TrackList() = default;
+  ~TrackList() = default;
+
+  TrackList(const TrackList&) = delete;
+  TrackList& operator=(const TrackList&) = delete;
+  TrackList(TrackList&&) = delete;
+  TrackList& operator=(TrackList&&) = delete;
+
+  /// return the number of tracks in the list
+  std::size_t size() const { return mSize; }
+  /// return true if the list contains no track
+  bool empty() const { return mSize == 0; }
+
+  iterator begin() { return iterator(this, mFirst); }
+  const_iterator begin() const { return const_iterator(this, mFirst); }
+  iterator end() { return iterator(this, End); }
+  const_iterator end() const { return const_iterator(this, End); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  template <class... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  /// add a new track constructed from args at the end of the list and return a reference to it
+  template <class... Args>
+  Track& emplace_back(Args&&... args)
+  {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  iterator erase(iterator pos);
+
+  /// remove all the tracks, keeping the allocated storage
+  void clear()
+  {
+    mTracks.clear();
+    mPrev.clear();
+    mNext.clear();
+    mFreeSlots.clear();
+    mFirst = End;
+    mLast = End;
+    mSize = 0;
+  }
+
+ private:
+  std::vector<Track> mTracks{};  ///< storage of the tracks, including the erased ones
+  std::vector<int> mPrev{};      ///< index of the previous track in the list for every slot
+  std::vector<int> mNext{};      ///< index of the next track in the list for every slot
+  std::vector<int> mFreeSlots{}; ///< slots of the erased tracks, to be reused
+  int mFirst = End;              ///< index of the first track in the list
+  int mLast = End;               ///< index of the last track in the list
+  std::size_t mSize = 0;         ///< number of tracks in the list
+};
+
+//_________________________________________________________________________________________________
+template <class... Args>
+TrackList::iterator TrackList::emplace(iterator pos, Args&&... args)
+{
+  /// insert a new track constructed from args before pos and return an iterator to it
+  /// the track is constructed before touching the storage as args may refer to a track of this list
+
+  Track track(std::forward<Args>(args)...);
+
+  int index(0);
+  if (mFreeSlots.empty()) {
+    index = mTracks.size();
+    mTracks.emplace_back(std::move(track));
+    mPrev.emplace_back(End);
+    mNext.emplace_back(End);
+  } else {
+    index = mFreeSlots.back();
+    mFreeSlots.pop_back();
+    mTracks[index] = std::move(track);
+  }
+
+  int next = pos.mIndex;
+  int prev = (next == End) ? mLast : mPrev[next];
+  mPrev[index] = prev;
+  mNext[index] = next;
+  if (prev == End) {
+    mFirst = index;
+  } else {
+    mNext[prev] = index;
+  }
+  if (next == End) {
+    mLast = index;
+  } else {
+    mPrev[next] = index;
+  }
+  ++mSize;
+
+  return iterator(this, index);
+}
+
+//_________________________________________________________________________________________________
+inline TrackList::iterator TrackList::erase(iterator pos)
+{
+  /// remove the track at pos from the list and return an iterator to the next one
+
+  int index = pos.mIndex;
+  int prev = mPrev[index];
+  int next = mNext[index];
+  if (prev == End) {
+    mFirst = next;
+  } else {
+    mNext[prev] = next;
+  }
+  if (next == End) {
+    mLast = prev;
+  } else {
+    mPrev[next] = prev;
+  }
+  --mSize;
+
+  // release the content of the track and keep its slot for a later insertion
+  mTracks[index] = Track();
+  mFreeSlots.emplace_back(index);
+
+  return iterator(this, next);
+}
+
+} // namespace mch
+} // namespace o2
+
+#endif // ALICEO2_MCH_TRACKLIST_H_
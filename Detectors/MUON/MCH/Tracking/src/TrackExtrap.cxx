@@ -23,6 +23,7 @@
 #include <TGeoShape.h>
 #include <TMath.h>
 
+#include "Field/MagneticField.h"
 #include "Framework/Logger.h"
 
 #include "MCHTracking/TrackParam.h"
@@ -35,8 +36,8 @@ namespace mch
 bool TrackExtrap::sExtrapV2 = false;
 double TrackExtrap::sSimpleBValue = 0.;
 bool TrackExtrap::sFieldON = false;
-std::size_t TrackExtrap::sNCallExtrapToZCov = 0;
-std::size_t TrackExtrap::sNCallField = 0;
+std::atomic<std::size_t> TrackExtrap::sNCallExtrapToZCov{0};
+std::atomic<std::size_t> TrackExtrap::sNCallField{0};
 
 //__________________________________________________________________________
 void TrackExtrap::setField()
@@ -51,6 +52,17 @@ void TrackExtrap::setField()
   LOG(INFO) << "Track extrapolation with magnetic field " << (sFieldON ? "ON" : "OFF");
 }
 
+//__________________________________________________________________________
+bool TrackExtrap::isFieldThreadSafe()
+{
+  /// Return true if the track extrapolation can run concurrently in several threads:
+  /// the field is OFF or it is evaluated by the O2 field map, which does not modify its state
+  if (!sFieldON) {
+    return true;
+  }
+  return dynamic_cast<const o2::field::MagneticField*>(TGeoGlobalMagField::Instance()->GetField()) != nullptr;
+}
+
 //__________________________________________________________________________
 double TrackExtrap::getImpactParamFromBendingMomentum(double bendingMomentum)
 {
@@ -162,7 +174,7 @@ bool TrackExtrap::extrapToZCov(TrackParam& trackParam, double zEnd, bool updateP
   /// Track parameters and their covariances extrapolated to the plane at "zEnd".
   /// On return, results from the extrapolation are updated in trackParam.
 
-  ++sNCallExtrapToZCov;
+  sNCallExtrapToZCov.fetch_add(1, std::memory_order_relaxed);
 
   if (trackParam.getZ() == zEnd) {
     return true; // nothing to be done if same z
@@ -1067,7 +1079,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
     }
     // cmodif: call gufld(vout,f) changed into:
     TGeoGlobalMagField::Instance()->Field(vout, f);
-    ++sNCallField;
+    sNCallField.fetch_add(1, std::memory_order_relaxed);
 
     // *
     // *             start of integration
@@ -1116,7 +1128,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
 
     // cmodif: call gufld(xyzt,f) changed into:
     TGeoGlobalMagField::Instance()->Field(xyzt, f);
-    ++sNCallField;
+    sNCallField.fetch_add(1, std::memory_order_relaxed);
 
     at = a + secxs[0];
     bt = b + secys[0];
@@ -1156,7 +1168,7 @@ bool TrackExtrap::extrapOneStepRungekutta(double charge, double step, const doub
 
     // cmodif: call gufld(xyzt,f) changed into:
     TGeoGlobalMagField::Instance()->Field(xyzt, f);
-    ++sNCallField;
+    sNCallField.fetch_add(1, std::memory_order_relaxed);
 
     z = z + (c + (seczs[0] + seczs[1] + seczs[2]) * kthird) * h;
     y = y + (b + (secys[0] + secys[1] + secys[2]) * kthird) * h;
@@ -17,6 +17,7 @@
 #include "MCHTracking/TrackFinder.h"
 
 #include <cassert>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
 
@@ -28,6 +29,10 @@
 #include "MCHTracking/TrackExtrap.h"
 #include "MCHTracking/TrackerParam.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2
 {
 namespace mch
@@ -40,9 +45,10 @@ constexpr double TrackFinder::SChamberThicknessInX0[10];
 constexpr int TrackFinder::SNDE[10];
 
 //_________________________________________________________________________________________________
-void TrackFinder::init(float l3Current, float dipoleCurrent)
+void TrackFinder::init(float l3Current, float dipoleCurrent, int nThreads)
 {
   /// Prepare to run the algorithm
+  /// The track candidates are followed with nThreads threads if the magnetic field can be evaluated concurrently
 
   // create the magnetic field map if not already done
   mTrackFitter.initField(l3Current, dipoleCurrent);
@@ -75,86 +81,118 @@ void TrackFinder::init(float l3Current, float dipoleCurrent)
   // grouping DEs in z-planes (2 for chambers 1-4 and 4 for chambers 5-10)
   for (int iCh = 0; iCh < 4; ++iCh) {
     mClusters[2 * iCh].reserve(2);
-    mClusters[2 * iCh].emplace_back(100 * (iCh + 1) + 1, nullptr);
-    mClusters[2 * iCh].emplace_back(100 * (iCh + 1) + 3, nullptr);
+    mClusters[2 * iCh].emplace_back(100 * (iCh + 1) + 1, gsl::span<const Cluster>{});
+    mClusters[2 * iCh].emplace_back(100 * (iCh + 1) + 3, gsl::span<const Cluster>{});
     mClusters[2 * iCh + 1].reserve(2);
-    mClusters[2 * iCh + 1].emplace_back(100 * (iCh + 1), nullptr);
-    mClusters[2 * iCh + 1].emplace_back(100 * (iCh + 1) + 2, nullptr);
+    mClusters[2 * iCh + 1].emplace_back(100 * (iCh + 1), gsl::span<const Cluster>{});
+    mClusters[2 * iCh + 1].emplace_back(100 * (iCh + 1) + 2, gsl::span<const Cluster>{});
   }
   for (int iCh = 4; iCh < 6; ++iCh) {
     mClusters[8 + 4 * (iCh - 4)].reserve(5);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1), nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 2, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 4, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 14, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 16, nullptr);
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1), gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 2, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 4, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 14, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 16, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 1].reserve(4);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 1, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 3, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 15, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 17, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 1, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 3, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 15, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 17, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 2].reserve(4);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 6, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 8, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 10, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 12, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 6, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 8, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 10, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 12, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 3].reserve(5);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 5, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 7, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 9, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 11, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 13, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 5, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 7, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 9, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 11, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 13, gsl::span<const Cluster>{});
   }
   for (int iCh = 6; iCh < 10; ++iCh) {
     mClusters[8 + 4 * (iCh - 4)].reserve(7);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1), nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 2, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 4, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 6, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 20, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 22, nullptr);
-    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 24, nullptr);
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1), gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 2, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 4, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 6, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 20, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 22, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4)].emplace_back(100 * (iCh + 1) + 24, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 1].reserve(6);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 1, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 3, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 5, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 21, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 23, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 25, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 1, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 3, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 5, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 21, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 23, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 1].emplace_back(100 * (iCh + 1) + 25, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 2].reserve(6);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 8, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 10, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 12, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 14, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 16, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 18, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 8, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 10, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 12, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 14, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 16, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 2].emplace_back(100 * (iCh + 1) + 18, gsl::span<const Cluster>{});
     mClusters[8 + 4 * (iCh - 4) + 3].reserve(7);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 7, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 9, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 11, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 13, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 15, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 17, nullptr);
-    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 19, nullptr);
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 7, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 9, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 11, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 13, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 15, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 17, gsl::span<const Cluster>{});
+    mClusters[8 + 4 * (iCh - 4) + 3].emplace_back(100 * (iCh + 1) + 19, gsl::span<const Cluster>{});
+  }
+
+  // prepare one additional track finder per thread to follow the candidates in parallel
+  mWorkers.clear();
+#ifndef WITH_OPENMP
+  if (nThreads > 1) {
+    LOG(WARNING) << "multithreading is not supported, following the track candidates sequentially";
+    nThreads = 1;
+  }
+#endif
+  if (nThreads > 1 && !TrackExtrap::isFieldThreadSafe()) {
+    LOG(WARNING) << "the magnetic field cannot be evaluated concurrently, following the track candidates sequentially";
+    nThreads = 1;
+  }
+  if (nThreads > 1) {
+    LOG(INFO) << "following the track candidates with " << nThreads << " threads";
+    for (int i = 0; i < nThreads; ++i) {
+      auto& worker = mWorkers.emplace_back(std::make_unique<TrackFinder>());
+      worker->init(l3Current, dipoleCurrent);
+      worker->mTrackFitter.useChamberResolution();
+    }
   }
 }
 
 //_________________________________________________________________________________________________
-const std::list<Track>& TrackFinder::findTracks(const std::unordered_map<int, std::list<Cluster>>& clusters)
+const TrackList& TrackFinder::findTracks(gsl::span<const ClusterStruct> clusters)
 {
   /// Run the track finder algorithm
+  /// the clusters are copied in an internal store, in which the tracks point, valid until the next call
 
   mTracks.clear();
 
-  // fill the internal array of pointers to the list of clusters per DE
+  // store the clusters contiguously per DE, keeping their input order within each DE
+  mDEClusterOffsets.fill(0);
+  for (const auto& cluster : clusters) {
+    ++mDEClusterOffsets[cluster.getDEId() + 1];
+  }
+  for (int iDE = 1; iDE <= SNDEIds; ++iDE) {
+    mDEClusterOffsets[iDE] += mDEClusterOffsets[iDE - 1];
+  }
+  mClusterStore.resize(clusters.size());
+  auto nextClusterIdx = mDEClusterOffsets;
+  for (const auto& cluster : clusters) {
+    mClusterStore[nextClusterIdx[cluster.getDEId()]++] = Cluster(cluster);
+  }
+
+  // fill the internal array of clusters per DE
   for (auto& plane : mClusters) {
     for (auto& de : plane) {
-      auto itDE = clusters.find(de.first);
-      if (itDE == clusters.end()) {
-        de.second = nullptr;
-      } else {
-        de.second = &(itDE->second);
-      }
+      de.second = gsl::span<const Cluster>(mClusterStore).subspan(mDEClusterOffsets[de.first],
+                                                                   mDEClusterOffsets[de.first + 1] - mDEClusterOffsets[de.first]);
     }
   }
 
@@ -178,11 +216,10 @@ const std::list<Track>& TrackFinder::findTracks(const std::unordered_map<int, st
 
   // track each candidate down to chamber 1 and remove it
   tStart = std::chrono::high_resolution_clock::now();
-  for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
-    std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
-    followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
-    print("findTracks: removing candidate at position #", getTrackIndex(itTrack));
-    itTrack = mTracks.erase(itTrack);
+  if (mWorkers.empty() || mDebugLevel > 0 || mTracks.size() < 2) {
+    followTracks();
+  } else {
+    followTracksInParallel();
   }
   tEnd = std::chrono::high_resolution_clock::now();
   mTimeFollowTracks += tEnd - tStart;
@@ -600,7 +637,7 @@ void TrackFinder::findMoreTrackCandidates()
 }
 
 //_________________________________________________________________________________________________
-std::list<Track>::iterator TrackFinder::findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const std::list<Track>::iterator& itFirstTrack)
+TrackList::iterator TrackFinder::findTrackCandidates(int plane1, int plane2, bool skipUsedPairs, const TrackList::iterator& itFirstTrack)
 {
   /// Find all combinations of clusters between the 2 planes that could belong to a valid track
   /// If skipUsedPairs == true: skip combinations of clusters already part of a track starting from itFirstTrack
@@ -622,22 +659,22 @@ std::list<Track>::iterator TrackFinder::findTrackCandidates(int plane1, int plan
   for (auto& de1 : mClusters[plane1]) {
 
     // skip DE without cluster
-    if (de1.second == nullptr) {
+    if (de1.second.empty()) {
       continue;
     }
 
-    for (const auto& cluster1 : *de1.second) {
+    for (const auto& cluster1 : de1.second) {
 
       double z1 = cluster1.getZ();
 
       for (auto& de2 : mClusters[plane2]) {
 
         // skip DE without cluster
-        if (de2.second == nullptr) {
+        if (de2.second.empty()) {
           continue;
         }
 
-        for (const auto& cluster2 : *de2.second) {
+        for (const auto& cluster2 : de2.second) {
 
           // skip combinations of clusters already part of a track if requested
           if (skipUsedPairs && itTrack != mTracks.end() && areUsed(cluster1, cluster2, itFirstTrack, std::next(itTrack))) {
@@ -685,7 +722,92 @@ std::list<Track>::iterator TrackFinder::findTrackCandidates(int plane1, int plan
 }
 
 //_________________________________________________________________________________________________
-std::list<Track>::iterator TrackFinder::followTrackInOverlapDE(const std::list<Track>::iterator& itTrack, int currentDE, int plane)
+void TrackFinder::followTracks()
+{
+  /// Track each candidate down to chamber 1 and replace it by the new tracks found
+
+  for (auto itTrack = mTracks.begin(); itTrack != mTracks.end();) {
+    std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+    followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+    print("followTracks: removing candidate at position #", getTrackIndex(itTrack));
+    itTrack = mTracks.erase(itTrack);
+  }
+}
+
+//_________________________________________________________________________________________________
+void TrackFinder::followTracksInParallel()
+{
+  /// Track each candidate down to chamber 1 and replace it by the new tracks found,
+  /// distributing the candidates among the workers, which share the clusters of this track finder
+  /// The tracks are stored in the same order as when following the candidates sequentially
+
+  for (auto& worker : mWorkers) {
+    for (int iPlane = 0; iPlane < 32; ++iPlane) {
+      for (size_t iDE = 0; iDE < mClusters[iPlane].size(); ++iDE) {
+        worker->mClusters[iPlane][iDE].second = mClusters[iPlane][iDE].second;
+      }
+    }
+  }
+
+  std::vector<TrackList::iterator> candidates{};
+  candidates.reserve(mTracks.size());
+  for (auto itTrack = mTracks.begin(); itTrack != mTracks.end(); ++itTrack) {
+    candidates.emplace_back(itTrack);
+  }
+  int nCandidates = candidates.size();
+  std::vector<std::vector<Track>> tracksPerCandidate(nCandidates);
+  std::vector<std::exception_ptr> errorPerCandidate(nCandidates);
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mWorkers.size())
+#endif
+  for (int i = 0; i < nCandidates; ++i) {
+    int iThread = 0;
+#ifdef WITH_OPENMP
+    iThread = omp_get_thread_num();
+#endif
+    auto& worker = *mWorkers[iThread];
+    try {
+      // the candidate is the only track in the list of the worker when its following starts
+      worker.mTracks.clear();
+      auto itTrack = worker.mTracks.emplace(worker.mTracks.end(), std::move(*candidates[i]));
+      std::unordered_map<int, std::unordered_set<uint32_t>> excludedClusters{};
+      worker.followTrackInChamber(itTrack, 5, 0, false, excludedClusters);
+      worker.mTracks.erase(itTrack);
+      tracksPerCandidate[i].reserve(worker.mTracks.size());
+      for (auto& track : worker.mTracks) {
+        tracksPerCandidate[i].emplace_back(std::move(track));
+      }
+    } catch (...) {
+      errorPerCandidate[i] = std::current_exception();
+    }
+  }
+
+  // report the first error as it would have been when following the candidates sequentially
+  for (const auto& error : errorPerCandidate) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  mTracks.clear();
+  for (auto& tracks : tracksPerCandidate) {
+    for (auto& track : tracks) {
+      mTracks.emplace_back(std::move(track));
+    }
+  }
+
+  for (auto& worker : mWorkers) {
+    mNCallTryOneCluster += worker->mNCallTryOneCluster;
+    mNCallTryOneClusterFast += worker->mNCallTryOneClusterFast;
+    worker->mNCallTryOneCluster = 0;
+    worker->mNCallTryOneClusterFast = 0;
+    worker->mTracks.clear();
+  }
+}
+
+//_________________________________________________________________________________________________
+TrackList::iterator TrackFinder::followTrackInOverlapDE(const TrackList::iterator& itTrack, int currentDE, int plane)
 {
   /// Follow the track candidate "itTrack" in the DE of the "plane" overlapping "currentDE" and look for compatible clusters
   /// The tracking starts from the current parameters, which are supposed to be at a cluster on the same chamber
@@ -710,7 +832,7 @@ std::list<Track>::iterator TrackFinder::followTrackInOverlapDE(const std::list<T
   for (auto& de : mClusters[plane]) {
 
     // skip DE without cluster
-    if (de.second == nullptr) {
+    if (de.second.empty()) {
       continue;
     }
 
@@ -720,7 +842,7 @@ std::list<Track>::iterator TrackFinder::followTrackInOverlapDE(const std::list<T
     }
 
     // look for cluster candidate in this DE
-    for (const auto& cluster : *de.second) {
+    for (const auto& cluster : de.second) {
 
       // try to add the current cluster
       if (!isCompatible(currentParam, cluster, paramAtCluster)) {
@@ -743,9 +865,9 @@ std::list<Track>::iterator TrackFinder::followTrackInOverlapDE(const std::list<T
 }
 
 //_________________________________________________________________________________________________
-std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::iterator& itTrack,
-                                                             int chamber, int lastChamber, bool canSkip,
-                                                             std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
+TrackList::iterator TrackFinder::followTrackInChamber(TrackList::iterator& itTrack,
+                                                      int chamber, int lastChamber, bool canSkip,
+                                                      std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
 {
   /// Follow the track candidate pointed to by "itTrack" to the given "chamber"
   /// The tracking starts from the current parameters, which must have already been set
@@ -835,9 +957,9 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
 }
 
 //_________________________________________________________________________________________________
-std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::iterator& itTrack,
-                                                             int plane1, int plane2, int lastChamber,
-                                                             std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
+TrackList::iterator TrackFinder::followTrackInChamber(TrackList::iterator& itTrack,
+                                                      int plane1, int plane2, int lastChamber,
+                                                      std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
 {
   /// Follow the track candidate pointed to by "itTrack" to the (half)chamber formed by "plane1" and "plane2"
   /// The tracking starts from the current parameters, which must have already been set
@@ -892,7 +1014,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
   for (auto& de1 : mClusters[plane1]) {
 
     // skip DE without cluster
-    if (de1.second == nullptr) {
+    if (de1.second.empty()) {
       continue;
     }
 
@@ -901,7 +1023,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
     bool hasExcludedClusters = (itExcludedClusters != excludedClusters.end());
 
     // look for cluster candidate in this DE
-    for (const auto& cluster1 : *de1.second) {
+    for (const auto& cluster1 : de1.second) {
 
       // skip excluded clusters
       if (hasExcludedClusters && itExcludedClusters->second.count(cluster1.getUniqueId()) > 0) {
@@ -929,7 +1051,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
       for (auto& de2 : mClusters[plane2]) {
 
         // skip DE without cluster
-        if (de2.second == nullptr) {
+        if (de2.second.empty()) {
           continue;
         }
 
@@ -939,7 +1061,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
         }
 
         // look for cluster candidate in this DE
-        for (const auto& cluster2 : *de2.second) {
+        for (const auto& cluster2 : de2.second) {
 
           // try to add the current cluster
           if (!isCompatible(currentParamAtCluster1, cluster2, paramAtCluster2)) {
@@ -985,7 +1107,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
   for (auto& de2 : mClusters[plane2]) {
 
     // skip DE without cluster
-    if (de2.second == nullptr) {
+    if (de2.second.empty()) {
       continue;
     }
 
@@ -994,7 +1116,7 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
     bool hasExcludedClusters = (itExcludedClusters != excludedClusters.end());
 
     // look for cluster candidate in this DE
-    for (const auto& cluster2 : *de2.second) {
+    for (const auto& cluster2 : de2.second) {
 
       // skip excluded clusters (in particular the ones already attached together with a cluster on plane1)
       if (hasExcludedClusters && itExcludedClusters->second.count(cluster2.getUniqueId()) > 0) {
@@ -1034,9 +1156,9 @@ std::list<Track>::iterator TrackFinder::followTrackInChamber(std::list<Track>::i
 }
 
 //_________________________________________________________________________________________________
-std::list<Track>::iterator TrackFinder::addClustersAndFollowTrack(std::list<Track>::iterator& itTrack, const TrackParam& paramAtCluster1,
-                                                                  const TrackParam* paramAtCluster2, int nextChamber, int lastChamber,
-                                                                  std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
+TrackList::iterator TrackFinder::addClustersAndFollowTrack(TrackList::iterator& itTrack, const TrackParam& paramAtCluster1,
+                                                           const TrackParam* paramAtCluster2, int nextChamber, int lastChamber,
+                                                           std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters)
 {
   /// If "nextChamber" >= 0: continue the tracking of "itTrack" up to "lastChamber", attach the two clusters
   /// to every new tracks found and return an iterator to the first of them (or mTracks.end() if none is found)
@@ -1350,7 +1472,7 @@ bool TrackFinder::isAcceptable(const TrackParam& param) const
 }
 
 //_________________________________________________________________________________________________
-void TrackFinder::prepareForwardTracking(std::list<Track>::iterator& itTrack, bool runSmoother)
+void TrackFinder::prepareForwardTracking(TrackList::iterator& itTrack, bool runSmoother)
 {
   /// Prepare the current track parameters in view of continuing the tracking in the forward chambers
   /// Run the smoother to recompute the parameters at last cluster if requested
@@ -1365,7 +1487,7 @@ void TrackFinder::prepareForwardTracking(std::list<Track>::iterator& itTrack, bo
 }
 
 //_________________________________________________________________________________________________
-void TrackFinder::prepareBackwardTracking(std::list<Track>::iterator& itTrack, bool refit)
+void TrackFinder::prepareBackwardTracking(TrackList::iterator& itTrack, bool refit)
 {
   /// Prepare the current track parameters in view of continuing the tracking in the backward chambers
   /// Refit the track to recompute the parameters at first cluster if requested
@@ -1424,7 +1546,7 @@ bool TrackFinder::propagateCurrentParam(Track& track, int chamber)
 }
 
 //_________________________________________________________________________________________________
-bool TrackFinder::areUsed(const Cluster& cl1, const Cluster& cl2, const std::list<Track>::iterator& itFirstTrack, const std::list<Track>::iterator& itLastTrack)
+bool TrackFinder::areUsed(const Cluster& cl1, const Cluster& cl2, const TrackList::iterator& itFirstTrack, const TrackList::iterator& itLastTrack)
 {
   /// Return true if the 2 clusters are already part of a track between itFirstTrack and mTracks.end()
 
@@ -1454,9 +1576,9 @@ bool TrackFinder::areUsed(const Cluster& cl1, const Cluster& cl2, const std::lis
 }
 
 //_________________________________________________________________________________________________
-void TrackFinder::excludeClustersFromIdenticalTracks(const std::list<Track>::iterator& itTrack,
+void TrackFinder::excludeClustersFromIdenticalTracks(const TrackList::iterator& itTrack,
                                                      std::unordered_map<int, std::unordered_set<uint32_t>>& excludedClusters,
-                                                     const std::list<Track>::iterator& itEndTrack)
+                                                     const TrackList::iterator& itEndTrack)
 {
   /// Find tracks in the range [mTracks.begin(), itEndTrack[ that contain all the clusters of itTrack
   /// and add the clusters that these tracks have on station 5 in the excludedClusters list
@@ -1590,7 +1712,7 @@ uint8_t TrackFinder::requestedStationMask() const
 }
 
 //_________________________________________________________________________________________________
-int TrackFinder::getTrackIndex(const std::list<Track>::iterator& itCurrentTrack) const
+int TrackFinder::getTrackIndex(const TrackList::iterator& itCurrentTrack) const
 {
   /// return the index of the track pointed to by the given iterator in the list of tracks
   /// return -1 if it points to mTracks.end()
@@ -0,0 +1,132 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testTrackFinder.cxx
+/// \brief Test the reproducibility of the tracking when the track candidates are followed in parallel
+
+#define BOOST_TEST_MODULE Test MCH TrackFinder
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+#include <boost/test/data/test_case.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <TGeoGlobalMagField.h>
+#include <TGeoField.h>
+
+#include "MCHBase/ClusterBlock.h"
+#include "MCHTracking/TrackFinder.h"
+#include "MCHTracking/TrackParam.h"
+
+using namespace o2::mch;
+
+namespace
+{
+
+/// content of a reconstructed track relevant for the comparison
+struct TrackResult {
+  std::vector<uint32_t> clusterIds{};
+  std::vector<double> parameters{};
+  double chi2 = 0.;
+};
+
+/// switch the field off, so that the test does not depend on the field map
+void initField()
+{
+  if (!TGeoGlobalMagField::Instance()->GetField()) {
+    TGeoGlobalMagField::Instance()->SetField(new TGeoUniformMagField(0., 0., 0.));
+    TGeoGlobalMagField::Instance()->Lock();
+  }
+}
+
+/// clusters of straight tracks coming from the vertex, with a close-by fake cluster
+/// in stations 1 and 2 to create several possible continuations for every candidate
+std::vector<ClusterStruct> createClusters()
+{
+  static constexpr double chamberZ[10] = {-526.16, -545.24, -676.4, -695.4, -967.5,
+                                          -998.5, -1276.5, -1307.5, -1406.6, -1437.6};
+  std::mt19937 generator(12345);
+  std::uniform_real_distribution<double> slope(-0.12, 0.12);
+  std::normal_distribution<double> resolution(0., 0.05);
+
+  std::vector<ClusterStruct> clusters{};
+  int clusterIndex[10]{};
+  auto addCluster = [&clusters, &clusterIndex](int chamber, double x, double y, double z) {
+    int deId = 100 * (chamber + 1);
+    if (chamber < 4) {
+      deId += (x > 0.) ? ((y > 0.) ? 0 : 3) : ((y > 0.) ? 1 : 2);
+    } else {
+      deId += (x > 0.) ? 0 : 9;
+    }
+    uint32_t uid = ClusterStruct::buildUniqueId(chamber, deId, clusterIndex[chamber]++);
+    clusters.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), 0.2f, 0.2f, uid, 0, 0});
+  };
+
+  for (int iTrack = 0; iTrack < 20; ++iTrack) {
+    double slopeX = slope(generator);
+    double slopeY = slope(generator);
+    for (int iCh = 0; iCh < 10; ++iCh) {
+      double x = slopeX * chamberZ[iCh] + resolution(generator);
+      double y = slopeY * chamberZ[iCh] + resolution(generator);
+      addCluster(iCh, x, y, chamberZ[iCh]);
+      if (iCh < 4) {
+        addCluster(iCh, x + 0.3, y - 0.2, chamberZ[iCh]);
+      }
+    }
+  }
+
+  return clusters;
+}
+
+/// reconstruct the tracks with the given number of threads and extract their content
+std::vector<TrackResult> findTracks(const std::vector<ClusterStruct>& clusters, int nThreads)
+{
+  TrackFinder trackFinder{};
+  trackFinder.init(0., 0., nThreads);
+  std::vector<TrackResult> results{};
+  for (const auto& track : trackFinder.findTracks(clusters)) {
+    auto& result = results.emplace_back();
+    for (const auto& param : track) {
+      result.clusterIds.push_back(param.getClusterPtr()->getUniqueId());
+    }
+    const auto& param = track.first();
+    result.parameters = {param.getNonBendingCoor(), param.getNonBendingSlope(), param.getBendingCoor(),
+                         param.getBendingSlope(), param.getInverseBendingMomentum()};
+    result.chi2 = param.getTrackChi2();
+  }
+  return results;
+}
+
+} // namespace
+
+BOOST_DATA_TEST_CASE(TrackingDoesNotDependOnTheNumberOfThreads, boost::unit_test::data::make({2, 3, 4}), nThreads)
+{
+  initField();
+  auto clusters = createClusters();
+  auto reference = findTracks(clusters, 1);
+  auto results = findTracks(clusters, nThreads);
+
+  BOOST_REQUIRE_EQUAL(results.size(), reference.size());
+  for (int iTrack = 0; iTrack < results.size(); ++iTrack) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(results[iTrack].clusterIds.begin(), results[iTrack].clusterIds.end(),
+                                  reference[iTrack].clusterIds.begin(), reference[iTrack].clusterIds.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(results[iTrack].parameters.begin(), results[iTrack].parameters.end(),
+                                  reference[iTrack].parameters.begin(), reference[iTrack].parameters.end());
+    BOOST_CHECK_EQUAL(results[iTrack].chi2, reference[iTrack].chi2);
+  }
+
+  // make sure the test is not trivially passing
+  BOOST_CHECK_GT(reference.size(), 1);
+}
@@ -17,8 +17,11 @@
 #include "MCHWorkflow/ClusterFinderOriginalSpec.h"
 
 #include <iostream>
+#include <algorithm>
 #include <fstream>
 #include <chrono>
+#include <iterator>
+#include <memory>
 #include <vector>
 #include <stdexcept>
 #include <string>
@@ -41,6 +44,10 @@
 #include "MCHBase/ClusterBlock.h"
 #include "MCHClustering/ClusterFinderOriginal.h"
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 namespace o2
 {
 namespace mch
@@ -65,10 +72,28 @@ class ClusterFinderOriginalTask
     bool run2Config = ic.options().get<bool>("run2-config");
     mClusterFinder.init(run2Config);
 
+    /// Prepare one additional clusterizer per thread to process the preclusters in parallel
+    mNThreads = std::max(1, ic.options().get<int>("nthreads"));
+#ifndef WITH_OPENMP
+    if (mNThreads > 1) {
+      LOG(WARNING) << "multithreading is not supported, processing the preclusters sequentially";
+      mNThreads = 1;
+    }
+#endif
+    if (mNThreads > 1) {
+      LOG(INFO) << "processing the preclusters with " << mNThreads << " threads";
+      for (int i = 0; i < mNThreads; ++i) {
+        mClusterFinders.emplace_back(std::make_unique<ClusterFinderOriginal>())->init(run2Config);
+      }
+    }
+
     /// Print the timer and clear the clusterizer when the processing is over
     ic.services().get<CallbackService>().set(CallbackService::Id::Stop, [this]() {
       LOG(INFO) << "cluster finder duration = " << mTimeClusterFinder.count() << " s";
       this->mClusterFinder.deinit();
+      for (auto& clusterFinder : this->mClusterFinders) {
+        clusterFinder->deinit();
+      }
     });
   }
 
@@ -95,17 +120,31 @@ class ClusterFinderOriginalTask
       //LOG(INFO) << "processing interaction: " << preClusterROF.getBCData() << "...";
 
       // clusterize every preclusters
+      auto preClustersROF = preClusters.subspan(preClusterROF.getFirstIdx(), preClusterROF.getNEntries());
       auto tStart = std::chrono::high_resolution_clock::now();
-      mClusterFinder.reset();
-      for (const auto& preCluster : preClusters.subspan(preClusterROF.getFirstIdx(), preClusterROF.getNEntries())) {
-        mClusterFinder.findClusters(digits.subspan(preCluster.firstDigit, preCluster.nDigits));
+      if (mNThreads > 1) {
+        findClustersParallel(preClustersROF, digits);
+      } else {
+        mClusterFinder.reset();
+        for (int i = 0; i < preClustersROF.size(); ++i) {
+          // same seeding as in findClustersParallel so that the results do not depend on the number of threads
+          mClusterFinder.setRandomSeed(preClusterSeed(i));
+          mClusterFinder.findClusters(digits.subspan(preClustersROF[i].firstDigit, preClustersROF[i].nDigits));
+        }
       }
       auto tEnd = std::chrono::high_resolution_clock::now();
       mTimeClusterFinder += tEnd - tStart;
 
       // fill the ouput messages
-      clusterROFs.emplace_back(preClusterROF.getBCData(), clusters.size(), mClusterFinder.getClusters().size());
-      writeClusters(clusters, usedDigits);
+      auto firstClusterIdx = clusters.size();
+      if (mNThreads > 1) {
+        for (int i = 0; i < preClustersROF.size(); ++i) {
+          writeClusters(mClustersPerPreCluster[i], mUsedDigitsPerPreCluster[i], firstClusterIdx, clusters, usedDigits);
+        }
+      } else {
+        writeClusters(mClusterFinder.getClusters(), mClusterFinder.getUsedDigits(), firstClusterIdx, clusters, usedDigits);
+      }
+      clusterROFs.emplace_back(preClusterROF.getBCData(), firstClusterIdx, clusters.size() - firstClusterIdx);
     }
 
     LOGP(info, "Found {:4d} clusters from {:4d} preclusters in {:2d} ROFs",
@@ -114,25 +153,70 @@ class ClusterFinderOriginalTask
 
  private:
   //_________________________________________________________________________________________________
-  void writeClusters(std::vector<ClusterStruct, o2::pmr::polymorphic_allocator<ClusterStruct>>& clusters,
+  void findClustersParallel(gsl::span<const PreCluster> preClusters, gsl::span<const Digit> digits)
+  {
+    /// clusterize the preclusters of the current event in parallel, one clusterizer per thread
+    /// the clusters and attached digits of every precluster are stored separately to be merged in the original order
+
+    int nPreClusters = preClusters.size();
+    mClustersPerPreCluster.resize(std::max<size_t>(mClustersPerPreCluster.size(), nPreClusters));
+    mUsedDigitsPerPreCluster.resize(std::max<size_t>(mUsedDigitsPerPreCluster.size(), nPreClusters));
+
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+    for (int i = 0; i < nPreClusters; ++i) {
+      int iThread = 0;
+#ifdef WITH_OPENMP
+      iThread = omp_get_thread_num();
+#endif
+      auto& clusterFinder = *mClusterFinders[iThread];
+      clusterFinder.reset();
+      // the random generator is reset for every precluster so that the results do not depend on the scheduling
+      clusterFinder.setRandomSeed(preClusterSeed(i));
+      clusterFinder.findClusters(digits.subspan(preClusters[i].firstDigit, preClusters[i].nDigits));
+      mClustersPerPreCluster[i] = clusterFinder.getClusters();
+      mUsedDigitsPerPreCluster[i] = clusterFinder.getUsedDigits();
+    }
+  }
+
+  //_________________________________________________________________________________________________
+  static uint32_t preClusterSeed(int iPreCluster)
+  {
+    /// seed of the random generator used to clusterize the precluster at the given index in the current event
+    /// it depends only on this index, whatever the thread processing the precluster, and must be non-zero
+    return iPreCluster + 1;
+  }
+
+  //_________________________________________________________________________________________________
+  void writeClusters(const std::vector<ClusterStruct>& newClusters, const std::vector<Digit>& newUsedDigits, size_t firstClusterIdx,
+                     std::vector<ClusterStruct, o2::pmr::polymorphic_allocator<ClusterStruct>>& clusters,
                      std::vector<Digit, o2::pmr::polymorphic_allocator<Digit>>& usedDigits) const
   {
-    /// fill the output messages with clusters and attached digits of the current event
+    /// fill the output messages with the given clusters and attached digits of the current event
     /// modify the references to the attached digits according to their position in the global vector
+    /// and the cluster index in the unique ID according to the position of the cluster in the current event
 
     auto clusterOffset = clusters.size();
-    clusters.insert(clusters.end(), mClusterFinder.getClusters().begin(), mClusterFinder.getClusters().end());
+    clusters.insert(clusters.end(), newClusters.begin(), newClusters.end());
 
     auto digitOffset = usedDigits.size();
-    usedDigits.insert(usedDigits.end(), mClusterFinder.getUsedDigits().begin(), mClusterFinder.getUsedDigits().end());
+    usedDigits.insert(usedDigits.end(), newUsedDigits.begin(), newUsedDigits.end());
 
     for (auto itCluster = clusters.begin() + clusterOffset; itCluster < clusters.end(); ++itCluster) {
       itCluster->firstDigit += digitOffset;
+      itCluster->uid = ClusterStruct::buildUniqueId(itCluster->getChamberId(), itCluster->getDEId(),
+                                                    std::distance(clusters.begin(), itCluster) - firstClusterIdx);
     }
   }
 
   ClusterFinderOriginal mClusterFinder{};             ///< clusterizer
   std::chrono::duration<double> mTimeClusterFinder{}; ///< timer
+
+  int mNThreads = 1;                                                    ///< number of threads used to process the preclusters
+  std::vector<std::unique_ptr<ClusterFinderOriginal>> mClusterFinders{}; ///< one clusterizer per thread
+  std::vector<std::vector<ClusterStruct>> mClustersPerPreCluster{};      ///< clusters found in every precluster
+  std::vector<std::vector<Digit>> mUsedDigitsPerPreCluster{};            ///< digits attached to the clusters of every precluster
 };
 
 //_________________________________________________________________________________________________
@@ -148,7 +232,8 @@ o2::framework::DataProcessorSpec getClusterFinderOriginalSpec(const char* name)
             OutputSpec{{"clusterdigits"}, "MCH", "CLUSTERDIGITS", 0, Lifetime::Timeframe}},
     AlgorithmSpec{adaptFromTask<ClusterFinderOriginalTask>()},
     Options{{"config", VariantType::String, "", {"JSON or INI file with clustering parameters"}},
-            {"run2-config", VariantType::Bool, false, {"setup for run2 data"}}}};
+            {"run2-config", VariantType::Bool, false, {"setup for run2 data"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads to process the preclusters"}}}};
 }
 
 } // end namespace mch
@@ -16,9 +16,9 @@
 
 #include "TrackFinderSpec.h"
 
+#include <algorithm>
 #include <chrono>
-#include <unordered_map>
-#include <list>
+#include <vector>
 #include <stdexcept>
 #include <string>
 #include <filesystem>
@@ -45,6 +45,7 @@
 #include "MCHTracking/Cluster.h"
 #include "MCHTracking/Track.h"
 #include "MCHTracking/TrackFinder.h"
+#include "MCHTracking/TrackList.h"
 #include "MCHTracking/TrackExtrap.h"
 
 namespace o2
@@ -84,7 +85,8 @@ class TrackFinderTask
     if (!config.empty()) {
       o2::conf::ConfigurableParam::updateFromFile(config, "MCHTracking", true);
     }
-    mTrackFinder.init(l3Current, dipoleCurrent);
+    auto nThreads = std::max(1, ic.options().get<int>("nthreads"));
+    mTrackFinder.init(l3Current, dipoleCurrent, nThreads);
 
     auto debugLevel = ic.options().get<int>("debug");
     mTrackFinder.debug(debugLevel);
@@ -118,15 +120,9 @@ class TrackFinderTask
 
       //LOG(INFO) << "processing interaction: " << clusterROF.getBCData() << "...";
 
-      // get the input clusters of the current event
-      std::unordered_map<int, std::list<Cluster>> clusters{};
-      for (const auto& cluster : clustersIn.subspan(clusterROF.getFirstIdx(), clusterROF.getNEntries())) {
-        clusters[cluster.getDEId()].emplace_back(cluster);
-      }
-
-      // run the track finder
+      // run the track finder on the clusters of the current event
       auto tStart = std::chrono::high_resolution_clock::now();
-      const auto& tracks = mTrackFinder.findTracks(clusters);
+      const auto& tracks = mTrackFinder.findTracks(clustersIn.subspan(clusterROF.getFirstIdx(), clusterROF.getNEntries()));
       auto tEnd = std::chrono::high_resolution_clock::now();
       mElapsedTime += tEnd - tStart;
 
@@ -142,7 +138,7 @@ class TrackFinderTask
 
  private:
   //_________________________________________________________________________________________________
-  void writeTracks(const std::list<Track>& tracks,
+  void writeTracks(const TrackList& tracks,
                    std::vector<TrackMCH, o2::pmr::polymorphic_allocator<TrackMCH>>& mchTracks,
                    std::vector<ClusterStruct, o2::pmr::polymorphic_allocator<ClusterStruct>>& usedClusters) const
   {
@@ -186,7 +182,8 @@ o2::framework::DataProcessorSpec getTrackFinderSpec(const char* name)
             {"dipoleCurrent", VariantType::Float, -6000.0f, {"Dipole current"}},
             {"grp-file", VariantType::String, o2::base::NameConf::getGRPFileName(), {"Name of the grp file"}},
             {"config", VariantType::String, "", {"JSON or INI file with tracking parameters"}},
-            {"debug", VariantType::Int, 0, {"debug level"}}}};
+            {"debug", VariantType::Int, 0, {"debug level"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads to follow the track candidates"}}}};
 }
 
 } // namespace mch
@@ -84,8 +84,9 @@ void CTFCoder::encode(VEC& buff, const CTFHelper::TFData& tfData)
   assignDictVersion(static_cast<o2::ctf::CTFDictHeader&>(ec->getHeader()));
   ec->getANSHeader().majorVersion = 0;
   ec->getANSHeader().minorVersion = 1;
-  // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
-#define ENCODEMID(beg, end, slot, bits) CTF::get(buff.data())->encode(beg, end, int(slot), bits, optField[int(slot)], &buff, mCoders[int(slot)].get());
+  // the columns are generated by the helper iterators during the encoding
+  ColumnsEncoder<CTF, VEC> columns(*this, buff, optField);
+#define ENCODEMID(beg, end, slot, bits) columns.add(beg, end, int(slot), bits);
   // clang-format off
   ENCODEMID(helper.begin_bcIncROF(),    helper.end_bcIncROF(),     CTF::BLC_bcIncROF,    0);
   ENCODEMID(helper.begin_orbitIncROF(), helper.end_orbitIncROF(),  CTF::BLC_orbitIncROF, 0);
@@ -96,6 +97,7 @@ void CTFCoder::encode(VEC& buff, const CTFHelper::TFData& tfData)
   ENCODEMID(helper.begin_deId(),        helper.end_deId(),         CTF::BLC_deId,        0);
   ENCODEMID(helper.begin_colId(),       helper.end_colId(),        CTF::BLC_colId,       0);
   // clang-format on
+  columns.finalize();
   CTF::get(buff.data())->print(getPrefix());
 }
 
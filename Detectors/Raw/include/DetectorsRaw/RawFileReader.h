@@ -19,11 +19,13 @@
 #include <cstdio>
 #include <unordered_map>
 #include <map>
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <string>
 #include <utility>
 #include <Rtypes.h>
+#include <gsl/span>
 #include "Headers/RAWDataHeader.h"
 #include "Headers/DataHeader.h"
 #include "DetectorsRaw/RDHUtils.h"
@@ -48,6 +50,7 @@ struct ReaderInp {
   uint32_t maxTF = 0xffffffff;
   bool partPerSP = true;
   bool cache = false;
+  bool mapFiles = false;
   bool autodetectTF0 = false;
   bool preferCalcTF = false;
 };
@@ -129,6 +132,16 @@ class RawFileReader
 
   //=====================================================================================
 
+  // view of the data in a memory-mapped input file, the mapping stays valid as long as the view (or a copy of
+  // its mapping pointer) exists, even if the reader is cleared. The mapping is private: modifications of the
+  // data are not written to the file
+  struct MappedView {
+    gsl::span<char> data{};        // mapped data
+    std::shared_ptr<char> mapping; // shared ownership of the whole mapped file
+    bool empty() const { return data.empty(); }
+    size_t size() const { return data.size(); }
+  };
+
   // reference on blocks making single message part
   struct PartStat {
     int size;    // total size
@@ -202,6 +215,8 @@ class RawFileReader
     size_t readNextHBF(char* buff);
     size_t readNextTF(char* buff);
     size_t readNextSuperPage(char* buff, const PartStat* pstat = nullptr);
+    MappedView readNextHBFView();
+    MappedView readNextSuperPageView(const PartStat* pstat = nullptr);
     size_t skipNextHBF();
     size_t skipNextTF();
 
@@ -210,6 +225,7 @@ class RawFileReader
     std::string describe() const;
 
    private:
+    MappedView getMappedView(int iblEnd, size_t size) const;
     RawFileReader* reader = nullptr; //!
   };
 
@@ -264,6 +280,10 @@ class RawFileReader
   bool getCacheData() const { return mCacheData; }
   void setCacheData(bool v) { mCacheData = v; }
 
+  bool getMapFiles() const { return mMapFiles; }
+  void setMapFiles(bool v) { mMapFiles = v; }
+  const char* getMappedData(const LinkBlock& blc, size_t size = 0) const;
+
   o2::header::DataOrigin getDefaultDataOrigin() const { return mDefDataOrigin; }
   o2::header::DataDescription getDefaultDataSpecification() const { return mDefDataDescription; }
   ReadoutCardType getDefaultReadoutCardType() const { return mDefCardType; }
@@ -284,6 +304,8 @@ class RawFileReader
  private:
   int getLinkLocalID(const RDHAny& rdh, int fileID);
   bool preprocessFile(int ifl);
+  void mapFiles();
+  void unmapFiles();
   static LinkSpec_t createSpec(o2::header::DataOrigin orig, LinkSubSpec_t ss) { return (LinkSpec_t(orig) << 32) | ss; }
 
   static constexpr o2::header::DataOrigin DEFDataOrigin = o2::header::gDataOriginFLP;
@@ -295,6 +317,7 @@ class RawFileReader
   std::vector<std::string> mFileNames;                                  //! input file names
   std::vector<FILE*> mFiles;                                            //! input file handlers
   std::vector<std::unique_ptr<char[]>> mFileBuffers;                    //! buffers for input files
+  std::vector<std::pair<std::shared_ptr<char>, size_t>> mMappedFiles;   //! memory-mapped input files (data, size)
   std::vector<OrigDescCard> mDataSpecs;                                 //! data origin and description for every input file + readout card type
   bool mInitDone = false;
   bool mEmpty = true;
@@ -312,6 +335,7 @@ class RawFileReader
   long int mPosInFile = 0;                                          //! current position in the file
   bool mMultiLinkFile = false;                                      //! was > than 1 link seen in the file?
   bool mCacheData = false;                                          //! cache data to block after 1st scan (may require excessive memory, use with care)
+  bool mMapFiles = false;                                           //! access data via memory-mapped input files instead of fread
   uint32_t mCheckErrors = 0;                                        //! mask for errors to check
   FirstTFDetection mFirstTFAutodetect = FirstTFDetection::Disabled; //!
   bool mPreferCalculatedTFStart = false;                            //! prefer TFstart calculated via HBFUtils
@@ -30,6 +30,8 @@
 #include <Common/Configuration.h>
 #include <TStopwatch.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace o2::raw;
 namespace o2h = o2::header;
@@ -133,6 +135,8 @@ size_t RawFileReader::LinkData::readNextHBF(char* buff)
     ibl++;
     if (blc.dataCache) {
       memcpy(buff + sz, blc.dataCache.get(), blc.size);
+    } else if (auto mapped = reader->getMappedData(blc)) {
+      memcpy(buff + sz, mapped, blc.size); // single copy from the page cache to the output buffer
     } else {
       auto fl = reader->mFiles[blc.fileID];
       if (fseek(fl, blc.offset, SEEK_SET) || fread(buff + sz, 1, blc.size, fl) != blc.size) {
@@ -287,6 +291,8 @@ size_t RawFileReader::LinkData::readNextSuperPage(char* buff, const RawFileReade
   if (sz) {
     if (reader->mCacheData && blocks[nextBlock2Read].dataCache) {
       memcpy(buff, blocks[nextBlock2Read].dataCache.get(), sz);
+    } else if (auto mapped = reader->getMappedData(blocks[nextBlock2Read], sz)) {
+      memcpy(buff, mapped, sz); // blocks of the superpage are contiguous in the file
     } else {
       auto fl = reader->mFiles[blocks[nextBlock2Read].fileID];
       if (fseek(fl, blocks[nextBlock2Read].offset, SEEK_SET) || fread(buff, 1, sz, fl) != sz) {
@@ -303,6 +309,78 @@ size_t RawFileReader::LinkData::readNextSuperPage(char* buff, const RawFileReade
   return error ? 0 : sz; // in case of the error we ignore the data
 }
 
+//____________________________________________
+RawFileReader::MappedView RawFileReader::LinkData::readNextHBFView()
+{
+  // provide the data of the next complete HB as a view of the memory-mapped input file, w/o copying it.
+  // If the file is not mapped or the blocks of the HB are not contiguous in it, an empty view is returned
+  // and the HB should be read by readNextHBF
+  if (nextBlock2Read < 0) { // negative nextBlock2Read signals absence of data
+    return {};
+  }
+  int ibl = nextBlock2Read, nbl = blocks.size();
+  size_t sz = 0;
+  while (ibl < nbl && blocks[ibl].ir == blocks[nextBlock2Read].ir) {
+    sz += blocks[ibl++].size;
+  }
+  auto view = getMappedView(ibl, sz);
+  if (!view.empty()) {
+    nextBlock2Read = ibl;
+  }
+  return view;
+}
+
+//____________________________________________
+RawFileReader::MappedView RawFileReader::LinkData::readNextSuperPageView(const RawFileReader::PartStat* pstat)
+{
+  // provide the data of the next superpage as a view of the memory-mapped input file, w/o copying it.
+  // If the file is not mapped, an empty view is returned and the superpage should be read by readNextSuperPage
+  if (nextBlock2Read < 0) { // negative nextBlock2Read signals absence of data
+    return {};
+  }
+  int ibl = nextBlock2Read, nbl = blocks.size();
+  size_t sz = 0;
+  if (pstat) { // info is provided, use it derictly
+    sz = pstat->size;
+    ibl += pstat->nBlocks;
+  } else { // need to calculate blocks to read
+    while (ibl < nbl) {
+      auto& blc = blocks[ibl];
+      if (ibl > nextBlock2Read && (blc.tfID != blocks[nextBlock2Read].tfID ||
+                                   blc.testFlag(LinkBlock::StartSP) ||
+                                   (sz + blc.size) > reader->mNominalSPageSize ||
+                                   blocks[ibl - 1].offset + blocks[ibl - 1].size < blc.offset)) { // new superpage or TF
+        break;
+      }
+      ibl++;
+      sz += blc.size;
+    }
+  }
+  auto view = getMappedView(ibl, sz);
+  if (!view.empty()) {
+    nextBlock2Read = ibl;
+  }
+  return view;
+}
+
+//____________________________________________
+RawFileReader::MappedView RawFileReader::LinkData::getMappedView(int iblEnd, size_t size) const
+{
+  // view of the blocks from nextBlock2Read to iblEnd (exclusive) in the mapped file,
+  // empty if the file is not mapped or the blocks are not contiguous in it
+  const auto& blc0 = blocks[nextBlock2Read];
+  for (int ibl = nextBlock2Read + 1; ibl < iblEnd; ibl++) {
+    if (blocks[ibl].fileID != blc0.fileID || blocks[ibl].offset != blocks[ibl - 1].offset + blocks[ibl - 1].size) {
+      return {};
+    }
+  }
+  auto mapped = size ? reader->getMappedData(blc0, size) : nullptr;
+  if (!mapped) {
+    return {};
+  }
+  return MappedView{gsl::span<char>(const_cast<char*>(mapped), size), reader->mMappedFiles[blc0.fileID].first};
+}
+
 //____________________________________________
 size_t RawFileReader::LinkData::getLargestSuperPage() const
 {
@@ -639,6 +717,7 @@ void RawFileReader::clear()
   mLinkEntries.clear();
   mOrderedIDs.clear();
   mLinksData.clear();
+  unmapFiles();
   for (auto fl : mFiles) {
     fclose(fl);
   }
@@ -650,6 +729,56 @@ void RawFileReader::clear()
   mInitDone = false;
 }
 
+//_____________________________________________________________________
+void RawFileReader::mapFiles()
+{
+  // map input files to memory, blocks data will be accessed directly in the mapped regions.
+  // The mappings are private and writable, so that the users of the views may modify the data (copy-on-write),
+  // and are released when neither the reader nor any view refers to them.
+  // In case of failure the file is read via its FILE* handle
+  mMappedFiles.clear();
+  for (size_t i = 0; i < mFiles.size(); i++) {
+    auto& mf = mMappedFiles.emplace_back(nullptr, 0);
+    int fd = fileno(mFiles[i]);
+    struct stat st;
+    if (fstat(fd, &st) || st.st_size == 0) {
+      LOG(WARNING) << "Failed to get size of " << mFileNames[i] << ", will not map it";
+      continue;
+    }
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (ptr == MAP_FAILED) {
+      LOG(WARNING) << "Failed to map " << mFileNames[i] << " to memory, will read it via stream";
+      continue;
+    }
+    madvise(ptr, st.st_size, MADV_WILLNEED);
+    size_t size = st.st_size;
+    mf.first.reset(reinterpret_cast<char*>(ptr), [size](char* p) { munmap(p, size); });
+    mf.second = size;
+    LOGF(INFO, "Mapped %zu bytes of %s", mf.second, mFileNames[i]);
+  }
+}
+
+//_____________________________________________________________________
+void RawFileReader::unmapFiles()
+{
+  // the files are unmapped once the views still in use are released
+  mMappedFiles.clear();
+}
+
+//_____________________________________________________________________
+const char* RawFileReader::getMappedData(const LinkBlock& blc, size_t size) const
+{
+  // pointer on the block data in the mapped file or nullptr if the file is not mapped
+  if (size_t(blc.fileID) >= mMappedFiles.size()) {
+    return nullptr;
+  }
+  const auto& mf = mMappedFiles[blc.fileID];
+  if (!mf.first || blc.offset + (size ? size : blc.size) > mf.second) {
+    return nullptr;
+  }
+  return mf.first.get() + blc.offset;
+}
+
 //_____________________________________________________________________
 bool RawFileReader::addFile(const std::string& sname, o2::header::DataOrigin origin, o2::header::DataDescription desc, ReadoutCardType t)
 {
@@ -699,6 +828,13 @@ bool RawFileReader::init()
     LOGF(INFO, "at most %u TF will be processed", mMaxTFToRead);
   }
 
+  if (mMapFiles) {
+    if (mCacheData) {
+      LOG(INFO) << "Data caching is not needed with memory-mapped input files, disabling it";
+      mCacheData = false;
+    }
+    mapFiles();
+  }
   int nf = mFiles.size();
   mEmpty = true;
   for (int i = 0; i < nf; i++) {
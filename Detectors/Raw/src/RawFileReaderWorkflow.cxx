@@ -37,6 +37,9 @@
 #include <cctype>
 #include <string>
 #include <climits>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <regex>
 
 using namespace o2::raw;
@@ -48,6 +51,7 @@ class RawReaderSpecs : public o2f::Task
 {
  public:
   static constexpr o2h::DataDescription gDataDescSubTimeFrame{"DISTSUBTIMEFRAME"};
+  static constexpr size_t PayloadAlignment = 64; // alignment of the payload messages
   struct STFHeader { // fake header to mimic DD SubTimeFrame::Header sent with DISTSUBTIMEFRAME message
     uint64_t mId = uint64_t(-1);
     uint32_t mFirstOrbit = uint32_t(-1);
@@ -96,6 +100,7 @@ RawReaderSpecs::RawReaderSpecs(const ReaderInp& rinp)
   mReader->setMaxTFToRead(rinp.maxTF);
   mReader->setNominalSPageSize(rinp.spSize);
   mReader->setCacheData(rinp.cache);
+  mReader->setMapFiles(rinp.mapFiles);
   mReader->setTFAutodetect(rinp.autodetectTF0 ? RawFileReader::FirstTFDetection::Pending : RawFileReader::FirstTFDetection::Disabled);
   mReader->setPreferCalculatedTFStart(rinp.preferCalcTF);
   LOG(INFO) << "Will preprocess files with buffer size of " << rinp.bufferSize << " bytes";
@@ -255,9 +260,27 @@ void RawReaderSpecs::run(o2f::ProcessingContext& ctx)
     while (hdrTmpl.splitPayloadIndex < hdrTmpl.splitPayloadParts) {
       hdrTmpl.payloadSize = mPartPerSP ? partsSP[hdrTmpl.splitPayloadIndex].size : link.getNextHBFSize();
       auto hdMessage = fmqFactory->CreateMessage(hstackSize, fair::mq::Alignment{64});
-      auto plMessage = fmqFactory->CreateMessage(hdrTmpl.payloadSize, fair::mq::Alignment{64});
+      FairMQMessagePtr plMessage;
+      size_t bread = 0;
       mTimer[TimerIO].Start(false);
-      auto bread = mPartPerSP ? link.readNextSuperPage(reinterpret_cast<char*>(plMessage->GetData()), &partsSP[hdrTmpl.splitPayloadIndex]) : link.readNextHBF(reinterpret_cast<char*>(plMessage->GetData()));
+      RawFileReader::MappedView view{};
+      if (mReader->getMapFiles()) { // try to ship the mapped pages w/o copying them
+        view = mPartPerSP ? link.readNextSuperPageView(&partsSP[hdrTmpl.splitPayloadIndex]) : link.readNextHBFView();
+      }
+      if (!view.empty() && reinterpret_cast<uintptr_t>(view.data.data()) % PayloadAlignment == 0) {
+        // the message holds a reference on the mapping, which is released by its deallocator
+        auto mapping = new std::shared_ptr<char>(std::move(view.mapping));
+        plMessage = fmqFactory->CreateMessage(
+          view.data.data(), view.size(), [](void*, void* hint) { delete static_cast<std::shared_ptr<char>*>(hint); }, mapping);
+        bread = view.size();
+      } else if (!view.empty()) { // misaligned in the file, copy to an aligned message
+        plMessage = fmqFactory->CreateMessage(view.size(), fair::mq::Alignment{PayloadAlignment});
+        memcpy(plMessage->GetData(), view.data.data(), view.size());
+        bread = view.size();
+      } else {
+        plMessage = fmqFactory->CreateMessage(hdrTmpl.payloadSize, fair::mq::Alignment{PayloadAlignment});
+        bread = mPartPerSP ? link.readNextSuperPage(reinterpret_cast<char*>(plMessage->GetData()), &partsSP[hdrTmpl.splitPayloadIndex]) : link.readNextHBF(reinterpret_cast<char*>(plMessage->GetData()));
+      }
       if (bread != hdrTmpl.payloadSize) {
         LOG(ERROR) << "Link " << il << " read " << bread << " bytes instead of " << hdrTmpl.payloadSize
                    << " expected in TF=" << mTFCounter << " part=" << hdrTmpl.splitPayloadIndex;
@@ -189,17 +189,22 @@ struct TestRawReader { // simple class to read detector raw data for multiple li
 
   std::unique_ptr<RawFileReader> reader;
   std::string confName;
+  int nViews = 0;                      // number of HBFs provided as views of the memory-mapped files
+  RawFileReader::MappedView firstView; // 1st of them, kept to check that it survives the reader
+  int firstViewLink = -1;              // link of the 1st view
+  int firstViewHBF = -1;               // and its HBF index in this link
 
   //_________________________________________________________________
   TestRawReader(const std::string& name = "TST", const std::string& cfg = "rawConf.cfg") : confName(cfg) {}
 
   //_________________________________________________________________
-  void init()
+  void init(bool mapFiles = false)
   {
     reader = std::make_unique<RawFileReader>(confName); // init from configuration file
     uint32_t errCheck = 0xffffffff;
     errCheck ^= 0x1 << RawFileReader::ErrNoSuperPageForTF; // makes no sense for superpages not interleaved by others
     reader->setCheckErrors(errCheck);
+    reader->setMapFiles(mapFiles);
     reader->init();
   }
 
@@ -225,6 +230,7 @@ struct TestRawReader { // simple class to read detector raw data for multiple li
     testStr.resize(RDHUtils::GBTWord);
     buffers.resize(nLinks); // 1 buffer per link
     firstHBF.resize(nLinks, true);
+    std::vector<int> nHBFRead(nLinks, 0);
 
     int nLinksRead = 0, nPreformatRead = 0;
     do {
@@ -238,7 +244,19 @@ struct TestRawReader { // simple class to read detector raw data for multiple li
           continue;
         }
         buff.resize(sz);
-        BOOST_CHECK(lnk.readNextHBF(buff.data()) == sz);
+        auto view = reader->getMapFiles() ? lnk.readNextHBFView() : RawFileReader::MappedView{};
+        if (!view.empty()) {
+          BOOST_CHECK(view.size() == sz);
+          std::copy(view.data.begin(), view.data.end(), buff.begin());
+          if (!nViews++) {
+            firstView = view;
+            firstViewLink = il;
+            firstViewHBF = nHBFRead[il];
+          }
+        } else {
+          BOOST_CHECK(lnk.readNextHBF(buff.data()) == sz);
+        }
+        nHBFRead[il]++;
         nLinksRead++;
       }
       if (nLinksRead) {
@@ -316,6 +334,25 @@ BOOST_AUTO_TEST_CASE(RawReaderWriter_CRU)
   TestRawReader dr{"TST", "test_raw_conf_GBT.cfg"}; // here we set the reader wrapper name just to deduce the input config name, everything else will be deduced from the config
   dr.init();
   dr.run(); // read back and check
+  //
+  TestRawReader drm{"TST", "test_raw_conf_GBT.cfg"};
+  drm.init(true); // read back via memory-mapped files
+  drm.run();
+  BOOST_CHECK(drm.nViews > 0);
+  // the views stay valid and writable after the reader is gone, w/o modifying the file
+  std::vector<char> viewData(drm.firstView.data.begin(), drm.firstView.data.end());
+  drm.reader.reset();
+  BOOST_CHECK(std::equal(viewData.begin(), viewData.end(), drm.firstView.data.begin()));
+  std::fill(drm.firstView.data.begin(), drm.firstView.data.end(), 0);
+  TestRawReader drc{"TST", "test_raw_conf_GBT.cfg"};
+  drc.init();
+  auto& lnk = drc.reader->getLink(drm.firstViewLink);
+  for (int i = 0; i < drm.firstViewHBF; i++) {
+    lnk.skipNextHBF();
+  }
+  std::vector<char> fileData(lnk.getNextHBFSize());
+  BOOST_CHECK(lnk.readNextHBF(fileData.data()) == viewData.size());
+  BOOST_CHECK(fileData == viewData);
 }
 
 BOOST_AUTO_TEST_CASE(RawReaderWriter_RORC)
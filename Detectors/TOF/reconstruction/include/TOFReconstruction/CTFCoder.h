@@ -24,6 +24,7 @@
 #include "rANS/rans.h"
 #include "DetectorsBase/CTFCoderBase.h"
 #include "TOFBase/Digit.h"
+#include "TOFReconstruction/CTFHelper.h"
 
 class TTree;
 
@@ -49,9 +50,7 @@ class CTFCoder : public o2::ctf::CTFCoderBase
   void createCoders(const std::string& dictPath, o2::ctf::CTFCoderBase::OpType op);
 
  private:
-  /// compres compact clusters to CompressedInfos
-  void compress(CompressedInfos& cc, const gsl::span<const ReadoutWindowData>& rofRecVec, const gsl::span<const Digit>& cdigVec, const gsl::span<const uint8_t>& pattVec);
-  size_t estimateCompressedSize(const CompressedInfos& cc);
+  size_t estimateCompressedSize(const CTFHelper& helper);
   /// decompress CompressedInfos to compact clusters
   template <typename VROF, typename VDIG, typename VPAT>
   void decompress(const CompressedInfos& cc, VROF& rofRecVec, VDIG& cdigVec, VPAT& pattVec);
@@ -83,34 +82,35 @@ void CTFCoder::encode(VEC& buff, const gsl::span<const ReadoutWindowData>& rofRe
     MD::EENCODE, //BLCtot
     MD::EENCODE, //BLCpattMap
   };
-  CompressedInfos cc;
-  compress(cc, rofRecVec, cdigVec, pattVec);
+  // the columns are produced on the fly from the digits, without intermediate CompressedInfos
+  CTFHelper helper(rofRecVec, cdigVec, pattVec);
   // book output size with some margin
-  auto szIni = estimateCompressedSize(cc);
+  auto szIni = estimateCompressedSize(helper);
   buff.resize(szIni);
 
   auto ec = CTF::create(buff);
   using ECB = CTF::base;
 
-  ec->setHeader(cc.header);
+  ec->setHeader(helper.createHeader());
   assignDictVersion(static_cast<o2::ctf::CTFDictHeader&>(ec->getHeader()));
   ec->getANSHeader().majorVersion = 0;
   ec->getANSHeader().minorVersion = 1;
-  // at every encoding the buffer might be autoexpanded, so we don't work with fixed pointer ec
-#define ENCODETOF(part, slot, bits) CTF::get(buff.data())->encode(part, int(slot), bits, optField[int(slot)], &buff, mCoders[int(slot)].get());
+  ColumnsEncoder<CTF, VEC> columns(*this, buff, optField);
+#define ENCODETOF(beg, end, slot, bits) columns.add(beg, end, int(slot), bits);
   // clang-format off
-  ENCODETOF(cc.bcIncROF,     CTF::BLCbcIncROF,     0);
-  ENCODETOF(cc.orbitIncROF,  CTF::BLCorbitIncROF,  0);
-  ENCODETOF(cc.ndigROF,      CTF::BLCndigROF,      0);
-  ENCODETOF(cc.ndiaROF,      CTF::BLCndiaROF,      0);
-  ENCODETOF(cc.ndiaCrate,    CTF::BLCndiaCrate,    0);
-  ENCODETOF(cc.timeFrameInc, CTF::BLCtimeFrameInc, 0);
-  ENCODETOF(cc.timeTDCInc,   CTF::BLCtimeTDCInc,   0);
-  ENCODETOF(cc.stripID,      CTF::BLCstripID,      0);
-  ENCODETOF(cc.chanInStrip,  CTF::BLCchanInStrip,  0);
-  ENCODETOF(cc.tot,          CTF::BLCtot,          0);
-  ENCODETOF(cc.pattMap,      CTF::BLCpattMap,      0);
+  ENCODETOF(helper.begin_bcIncROF(),     helper.end_bcIncROF(),     CTF::BLCbcIncROF,     0);
+  ENCODETOF(helper.begin_orbitIncROF(),  helper.end_orbitIncROF(),  CTF::BLCorbitIncROF,  0);
+  ENCODETOF(helper.begin_ndigROF(),      helper.end_ndigROF(),      CTF::BLCndigROF,      0);
+  ENCODETOF(helper.begin_ndiaROF(),      helper.end_ndiaROF(),      CTF::BLCndiaROF,      0);
+  ENCODETOF(helper.begin_ndiaCrate(),    helper.end_ndiaCrate(),    CTF::BLCndiaCrate,    0);
+  ENCODETOF(helper.begin_timeFrameInc(), helper.end_timeFrameInc(), CTF::BLCtimeFrameInc, 0);
+  ENCODETOF(helper.begin_timeTDCInc(),   helper.end_timeTDCInc(),   CTF::BLCtimeTDCInc,   0);
+  ENCODETOF(helper.begin_stripID(),      helper.end_stripID(),      CTF::BLCstripID,      0);
+  ENCODETOF(helper.begin_chanInStrip(),  helper.end_chanInStrip(),  CTF::BLCchanInStrip,  0);
+  ENCODETOF(helper.begin_tot(),          helper.end_tot(),          CTF::BLCtot,          0);
+  ENCODETOF(pattVec.begin(),             pattVec.end(),             CTF::BLCpattMap,      0);
   // clang-format on
+  columns.finalize();
   CTF::get(buff.data())->print(getPrefix());
 }
 
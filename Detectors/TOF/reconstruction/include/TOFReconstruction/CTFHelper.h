@@ -0,0 +1,285 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file   CTFHelper.h
+/// \brief  Helper for TOF CTF creation, producing the CTF columns directly from the digits
+
+#ifndef O2_TOF_CTF_HELPER_H
+#define O2_TOF_CTF_HELPER_H
+
+#include "DataFormatsTOF/CTF.h"
+#include "TOFBase/Digit.h"
+#include "TOFBase/Geo.h"
+#include <gsl/span>
+#include <algorithm>
+#include <vector>
+
+namespace o2
+{
+namespace tof
+{
+
+class CTFHelper
+{
+
+ public:
+  static constexpr int NCrates = 72; // number of diagnostic counters per ROF
+
+  /// the only intermediate data are the time ordering of the digits of each ROF and the offsets of the ROFs in it
+  CTFHelper(const gsl::span<const ReadoutWindowData>& rofData, const gsl::span<const Digit>& digData, const gsl::span<const uint8_t>& pattData);
+  CTFHelper() = delete;
+
+  CTFHeader createHeader() const;
+
+  /// size of the columns, as if they were materialized
+  size_t getSize() const
+  {
+    return mROFData.size() * (sizeof(uint16_t) + 3 * sizeof(uint32_t) + NCrates * sizeof(uint32_t)) +
+           mDigitOrder.size() * (4 * sizeof(uint16_t) + sizeof(uint8_t)) + mPattData.size();
+  }
+
+  //>>> =========================== ITERATORS ========================================
+
+  template <typename I, typename T>
+  class _Iter
+  {
+   public:
+    using difference_type = int64_t;
+    using value_type = T;
+    using pointer = const T*;
+    using reference = const T&;
+    using iterator_category = std::random_access_iterator_tag;
+
+    _Iter(const CTFHelper& helper, size_t size, bool end = false) : mHelper(&helper), mIndex(end ? size : 0){};
+    _Iter() = default;
+
+    const I& operator++()
+    {
+      ++mIndex;
+      return (I&)(*this);
+    }
+
+    const I& operator--()
+    {
+      mIndex--;
+      return (I&)(*this);
+    }
+
+    difference_type operator-(const I& other) const { return mIndex - other.mIndex; }
+
+    difference_type operator-(size_t idx) const { return mIndex - idx; }
+
+    const I& operator-(size_t idx)
+    {
+      mIndex -= idx;
+      return (I&)(*this);
+    }
+
+    bool operator!=(const I& other) const { return mIndex != other.mIndex; }
+    bool operator==(const I& other) const { return mIndex == other.mIndex; }
+    bool operator>(const I& other) const { return mIndex > other.mIndex; }
+    bool operator<(const I& other) const { return mIndex < other.mIndex; }
+
+   protected:
+    const CTFHelper* mHelper = nullptr;
+    size_t mIndex = 0;
+  };
+
+  //_______________________________________________
+  // BC difference wrt previous if in the same orbit, otherwise the abs.value.
+  // For the very 1st entry return 0 (diff wrt 1st BC in the CTF header)
+  class Iter_bcIncROF : public _Iter<Iter_bcIncROF, uint16_t>
+  {
+   public:
+    using _Iter<Iter_bcIncROF, uint16_t>::_Iter;
+    value_type operator*() const
+    {
+      const auto& rofs = mHelper->mROFData;
+      if (mIndex) {
+        if (rofs[mIndex].getBCData().orbit == rofs[mIndex - 1].getBCData().orbit) {
+          return rofs[mIndex].getBCData().bc - rofs[mIndex - 1].getBCData().bc;
+        } else {
+          return rofs[mIndex].getBCData().bc;
+        }
+      }
+      return 0;
+    }
+  };
+
+  //_______________________________________________
+  // Orbit difference wrt previous. For the very 1st entry return 0 (diff wrt 1st BC in the CTF header)
+  class Iter_orbitIncROF : public _Iter<Iter_orbitIncROF, uint32_t>
+  {
+   public:
+    using _Iter<Iter_orbitIncROF, uint32_t>::_Iter;
+    value_type operator*() const
+    {
+      const auto& rofs = mHelper->mROFData;
+      return mIndex ? rofs[mIndex].getBCData().orbit - rofs[mIndex - 1].getBCData().orbit : 0;
+    }
+  };
+
+  //_______________________________________________
+  // Number of digits in the ROF
+  class Iter_ndigROF : public _Iter<Iter_ndigROF, uint32_t>
+  {
+   public:
+    using _Iter<Iter_ndigROF, uint32_t>::_Iter;
+    value_type operator*() const { return mHelper->mROFData[mIndex].size(); }
+  };
+
+  //_______________________________________________
+  // Number of diagnostic words in the ROF
+  class Iter_ndiaROF : public _Iter<Iter_ndiaROF, uint32_t>
+  {
+   public:
+    using _Iter<Iter_ndiaROF, uint32_t>::_Iter;
+    value_type operator*() const { return mHelper->mROFData[mIndex].sizeDia(); }
+  };
+
+  //_______________________________________________
+  // Number of diagnostic words per crate in the ROF, shifted by one since -1 means crate not available
+  class Iter_ndiaCrate : public _Iter<Iter_ndiaCrate, uint32_t>
+  {
+   public:
+    using _Iter<Iter_ndiaCrate, uint32_t>::_Iter;
+    value_type operator*() const
+    {
+      const auto& rof = mHelper->mROFData[mIndex / NCrates];
+      int crate = mIndex % NCrates;
+      return rof.isEmptyCrate(crate) ? 0 : rof.getDiagnosticInCrate(crate) + 1;
+    }
+  };
+
+  //_______________________________________________
+  // Time increment wrt previous digit of the ROF in TimeFrame units, 0 if in the same TimeFrame
+  class Iter_timeFrameInc : public _Iter<Iter_timeFrameInc, uint16_t>
+  {
+   public:
+    using _Iter<Iter_timeFrameInc, uint16_t>::_Iter;
+    value_type operator*() const
+    {
+      auto [timeFrame, tdc, prevTimeFrame, prevTDC] = mHelper->getTimes(mIndex);
+      return timeFrame == prevTimeFrame ? 0 : timeFrame - prevTimeFrame;
+    }
+  };
+
+  //_______________________________________________
+  // TDC increment wrt previous digit of the ROF if in the same TimeFrame, otherwise the abs.value
+  class Iter_timeTDCInc : public _Iter<Iter_timeTDCInc, uint16_t>
+  {
+   public:
+    using _Iter<Iter_timeTDCInc, uint16_t>::_Iter;
+    value_type operator*() const
+    {
+      auto [timeFrame, tdc, prevTimeFrame, prevTDC] = mHelper->getTimes(mIndex);
+      return timeFrame == prevTimeFrame ? tdc - prevTDC : tdc;
+    }
+  };
+
+  //_______________________________________________
+  class Iter_stripID : public _Iter<Iter_stripID, uint16_t>
+  {
+   public:
+    using _Iter<Iter_stripID, uint16_t>::_Iter;
+    value_type operator*() const { return mHelper->getDigit(mIndex).getChannel() / Geo::NPADS; }
+  };
+
+  //_______________________________________________
+  class Iter_chanInStrip : public _Iter<Iter_chanInStrip, uint8_t>
+  {
+   public:
+    using _Iter<Iter_chanInStrip, uint8_t>::_Iter;
+    value_type operator*() const { return mHelper->getDigit(mIndex).getChannel() % Geo::NPADS; }
+  };
+
+  //_______________________________________________
+  class Iter_tot : public _Iter<Iter_tot, uint16_t>
+  {
+   public:
+    using _Iter<Iter_tot, uint16_t>::_Iter;
+    value_type operator*() const { return mHelper->getDigit(mIndex).getTOT(); }
+  };
+
+  //<<< =========================== ITERATORS ========================================
+
+  Iter_bcIncROF begin_bcIncROF() const { return Iter_bcIncROF(*this, mROFData.size(), false); }
+  Iter_bcIncROF end_bcIncROF() const { return Iter_bcIncROF(*this, mROFData.size(), true); }
+
+  Iter_orbitIncROF begin_orbitIncROF() const { return Iter_orbitIncROF(*this, mROFData.size(), false); }
+  Iter_orbitIncROF end_orbitIncROF() const { return Iter_orbitIncROF(*this, mROFData.size(), true); }
+
+  Iter_ndigROF begin_ndigROF() const { return Iter_ndigROF(*this, mROFData.size(), false); }
+  Iter_ndigROF end_ndigROF() const { return Iter_ndigROF(*this, mROFData.size(), true); }
+
+  Iter_ndiaROF begin_ndiaROF() const { return Iter_ndiaROF(*this, mROFData.size(), false); }
+  Iter_ndiaROF end_ndiaROF() const { return Iter_ndiaROF(*this, mROFData.size(), true); }
+
+  Iter_ndiaCrate begin_ndiaCrate() const { return Iter_ndiaCrate(*this, mROFData.size() * NCrates, false); }
+  Iter_ndiaCrate end_ndiaCrate() const { return Iter_ndiaCrate(*this, mROFData.size() * NCrates, true); }
+
+  Iter_timeFrameInc begin_timeFrameInc() const { return Iter_timeFrameInc(*this, mDigitOrder.size(), false); }
+  Iter_timeFrameInc end_timeFrameInc() const { return Iter_timeFrameInc(*this, mDigitOrder.size(), true); }
+
+  Iter_timeTDCInc begin_timeTDCInc() const { return Iter_timeTDCInc(*this, mDigitOrder.size(), false); }
+  Iter_timeTDCInc end_timeTDCInc() const { return Iter_timeTDCInc(*this, mDigitOrder.size(), true); }
+
+  Iter_stripID begin_stripID() const { return Iter_stripID(*this, mDigitOrder.size(), false); }
+  Iter_stripID end_stripID() const { return Iter_stripID(*this, mDigitOrder.size(), true); }
+
+  Iter_chanInStrip begin_chanInStrip() const { return Iter_chanInStrip(*this, mDigitOrder.size(), false); }
+  Iter_chanInStrip end_chanInStrip() const { return Iter_chanInStrip(*this, mDigitOrder.size(), true); }
+
+  Iter_tot begin_tot() const { return Iter_tot(*this, mDigitOrder.size(), false); }
+  Iter_tot end_tot() const { return Iter_tot(*this, mDigitOrder.size(), true); }
+
+  const gsl::span<const uint8_t>& getPatterns() const { return mPattData; }
+
+ private:
+  struct DigitTimes {
+    int timeFrame = 0;
+    int tdc = 0;
+    int prevTimeFrame = 0;
+    int prevTDC = 0;
+  };
+
+  /// i-th digit in the time order
+  const Digit& getDigit(size_t i) const { return mDigData[mDigitOrder[i]]; }
+
+  /// TimeFrame and TDC of the i-th digit in the time order and of the previous digit of its ROF (0 for the 1st one)
+  DigitTimes getTimes(size_t i) const
+  {
+    auto irof = std::upper_bound(mROFFirstDigit.begin(), mROFFirstDigit.end(), i) - mROFFirstDigit.begin() - 1;
+    int64_t rofInBC = mROFData[irof].getBCData().toLong();
+    auto times = [this, rofInBC](size_t idig, int& timeFrame, int& tdc) {
+      int deltaBC = getDigit(idig).getBC() - rofInBC;
+      timeFrame = deltaBC / 64;
+      tdc = (deltaBC % 64) * 1024 + getDigit(idig).getTDC();
+    };
+    DigitTimes res;
+    times(i, res.timeFrame, res.tdc);
+    if (i > mROFFirstDigit[irof]) {
+      times(i - 1, res.prevTimeFrame, res.prevTDC);
+    }
+    return res;
+  }
+
+  const gsl::span<const ReadoutWindowData> mROFData;
+  const gsl::span<const Digit> mDigData;
+  const gsl::span<const uint8_t> mPattData;
+  std::vector<uint32_t> mDigitOrder;    // indices of the digits, in time order within each ROF
+  std::vector<uint32_t> mROFFirstDigit; // position of the 1st digit of each ROF in mDigitOrder, the ROFs being consecutive
+};
+
+} // namespace tof
+} // namespace o2
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file   CTFHelper.cxx
+/// \brief  Helper for TOF CTF creation, producing the CTF columns directly from the digits
+
+#include "TOFReconstruction/CTFHelper.h"
+#include <numeric>
+
+using namespace o2::tof;
+
+///________________________________
+CTFHelper::CTFHelper(const gsl::span<const ReadoutWindowData>& rofData, const gsl::span<const Digit>& digData, const gsl::span<const uint8_t>& pattData)
+  : mROFData(rofData), mDigData(digData), mPattData(pattData)
+{
+  mDigitOrder.resize(mDigData.size());
+  std::iota(mDigitOrder.begin(), mDigitOrder.end(), 0);
+  mROFFirstDigit.reserve(mROFData.size());
+  for (const auto& rof : mROFData) {
+    mROFFirstDigit.push_back(rof.first());
+    // sort digits of the ROF according to time (ascending order)
+    auto beg = mDigitOrder.begin() + rof.first(), end = beg + rof.size();
+    std::sort(beg, end, [this](uint32_t a, uint32_t b) {
+      const auto &digA = mDigData[a], &digB = mDigData[b];
+      if (digA.getBC() == digB.getBC()) {
+        return digA.getTDC() < digB.getTDC();
+      } else {
+        return digA.getBC() < digB.getBC();
+      }
+    });
+  }
+}
+
+///________________________________
+CTFHeader CTFHelper::createHeader() const
+{
+  CTFHeader h;
+  h.nROFs = mROFData.size();
+  h.nDigits = mDigData.size();
+  h.nPatternBytes = mPattData.size();
+  if (mROFData.size()) {
+    h.firstOrbit = mROFData[0].getBCData().orbit;
+    h.firstBC = mROFData[0].getBCData().bc;
+  }
+  return h;
+}
@@ -16,7 +16,8 @@
 #ifndef ALICEO2_TPC_DigitContainer_H_
 #define ALICEO2_TPC_DigitContainer_H_
 
-#include <deque>
+#include <algorithm>
+#include <vector>
 #include "TPCBase/CRU.h"
 #include "DataFormatsTPC/Defs.h"
 #include "TPCSimulation/DigitTime.h"
@@ -37,6 +38,8 @@ class Digit;
 /// sorted into after amplification
 /// The structure assures proper sorting of the Digits when later on written out for further processing.
 /// This class holds the time bin containers.
+/// The time bins are kept in a ring buffer: the ones written out are reset and reused for later time bins,
+/// so that no memory is allocated or freed during the digitization once the buffer has its final size.
 
 class DigitContainer
 {
@@ -53,6 +56,10 @@ class DigitContainer
   /// Reserve space in the container for a given event
   void reserve(TimeBin eventTimeBin);
 
+  /// Set the SAMPA processing used to make the signal, by default the shared instance
+  /// \param sampaProcessing SAMPA processing to be used
+  void setSAMPAProcessing(SAMPAProcessing& sampaProcessing) { mSAMPAProcessing = &sampaProcessing; }
+
   /// Set the start time of the first event
   /// \param time Time of the first event
   void setStartTime(TimeBin time) { mFirstTimeBin = time; }
@@ -77,14 +84,21 @@ class DigitContainer
   void fillOutputContainer(std::vector<Digit>& output, dataformats::MCTruthContainer<MCCompLabel>& mcTruth, std::vector<CommonMode>& commonModeOutput, const Sector& sector, TimeBin eventTimeBin = 0, bool isContinuous = true, bool finalFlush = false);
 
   /// Get the size of the container for one event
-  size_t size() const { return mTimeBins.size(); }
+  size_t size() const { return mNTimeBins; }
 
  private:
-  TimeBin mFirstTimeBin = 0;       ///< First time bin to consider
-  TimeBin mEffectiveTimeBin = 0;   ///< Effective time bin of that digit
-  TimeBin mTmaxTriggered = 0;      ///< Maximum time bin in case of triggered mode (hard cut at average drift speed with additional margin)
-  TimeBin mOffset;                 ///< Size of the container for one event
-  std::deque<DigitTime> mTimeBins; ///< Time bin Container for the ADC value
+  /// Get the time bin container at a given position with respect to the first time bin
+  DigitTime& getTimeBin(size_t position);
+
+  TimeBin mFirstTimeBin = 0;                                ///< First time bin to consider
+  TimeBin mEffectiveTimeBin = 0;                            ///< Effective time bin of that digit
+  TimeBin mTmaxTriggered = 0;                               ///< Maximum time bin in case of triggered mode (hard cut at average drift speed with additional margin)
+  TimeBin mOffset;                                          ///< Size of the container for one event
+  size_t mFirstBin = 0;                                     ///< Position of the first time bin in the ring buffer
+  size_t mNTimeBins = 0;                                    ///< Number of time bins in use
+  SAMPAProcessing* mSAMPAProcessing = nullptr;              ///< SAMPA processing used to make the signal
+  std::vector<DigitTime> mTimeBins;                         ///< Ring buffer of time bin containers for the ADC value
+  std::vector<std::pair<MCCompLabel, int>> mLabelCollector; ///< Workspace container for sorting the MC labels
 };
 
 inline DigitContainer::DigitContainer()
@@ -93,10 +107,12 @@ inline DigitContainer::DigitContainer()
   auto& gasParam = ParameterGas::Instance();
   auto& eleParam = ParameterElectronics::Instance();
   mTmaxTriggered = detParam.TmaxTriggered;
+  mSAMPAProcessing = &SAMPAProcessing::instance();
 
   // always have 50 % contingency for the size of the container depending on the input
   mOffset = static_cast<TimeBin>(1.5 * detParam.TPClength / gasParam.DriftV / eleParam.ZbinWidth);
   mTimeBins.resize(mOffset);
+  mNTimeBins = mOffset;
 }
 
 inline void DigitContainer::reset()
@@ -110,16 +126,29 @@ inline void DigitContainer::reset()
 
 inline void DigitContainer::reserve(TimeBin eventTimeBin)
 {
-  if (mTimeBins.size() < mOffset + eventTimeBin - mFirstTimeBin) {
-    mTimeBins.resize(mOffset + eventTimeBin - mFirstTimeBin);
+  const size_t nTimeBins = mOffset + eventTimeBin - mFirstTimeBin;
+  if (mNTimeBins < nTimeBins) {
+    if (mTimeBins.size() < nTimeBins) {
+      // unroll the ring buffer before growing it, the new (empty) time bins are appended after the last one in use
+      std::rotate(mTimeBins.begin(), mTimeBins.begin() + mFirstBin, mTimeBins.end());
+      mFirstBin = 0;
+      mTimeBins.resize(nTimeBins);
+    }
+    mNTimeBins = nTimeBins;
   }
 }
 
+inline DigitTime& DigitContainer::getTimeBin(size_t position)
+{
+  position += mFirstBin;
+  return mTimeBins[position < mTimeBins.size() ? position : position - mTimeBins.size()];
+}
+
 inline void DigitContainer::addDigit(const MCCompLabel& label, const CRU& cru, TimeBin timeBin, GlobalPadNumber globalPad,
                                      float signal)
 {
   mEffectiveTimeBin = timeBin - mFirstTimeBin;
-  mTimeBins[mEffectiveTimeBin].addDigit(label, cru, globalPad, signal);
+  getTimeBin(mEffectiveTimeBin).addDigit(label, cru, globalPad, signal);
 }
 
 } // namespace tpc
@@ -72,12 +72,17 @@ class DigitGlobalPad
   /// \param cru CRU ID
   /// \param timeBin Time bin
   /// \param globalPad Global pad ID
+  /// \param labelContainer Container of the MC labels of the time bin
+  /// \param sampaProcessing SAMPA processing used to make the signal
+  /// \param labelCollector Workspace container for sorting the MC labels
   /// \param commonMode Common mode value of that specific ROC
   template <DigitzationMode MODE>
   void fillOutputContainer(std::vector<Digit>& output, dataformats::MCTruthContainer<MCCompLabel>& mcTruth,
                            const CRU& cru, TimeBin timeBin,
                            GlobalPadNumber globalPad,
                            o2::dataformats::LabelContainer<std::pair<MCCompLabel, int>, false>& labelContainer,
+                           SAMPAProcessing& sampaProcessing,
+                           std::vector<std::pair<MCCompLabel, int>>& labelCollector,
                            float commonMode = 0.f);
 
  private:
@@ -115,6 +120,7 @@ inline void DigitGlobalPad::addDigit(const MCCompLabel& label, float signal,
 inline void DigitGlobalPad::reset()
 {
   mChargePad = 0;
+  mID = -1;
 }
 
 inline bool DigitGlobalPad::compareMClabels(const MCCompLabel& label1, const MCCompLabel& label2) const
@@ -131,12 +137,12 @@ inline void DigitGlobalPad::fillOutputContainer(std::vector<Digit>& output,
                                                 const CRU& cru, TimeBin timeBin,
                                                 GlobalPadNumber globalPad,
                                                 o2::dataformats::LabelContainer<std::pair<MCCompLabel, int>, false>& labels,
+                                                SAMPAProcessing& sampaProcessing,
+                                                std::vector<std::pair<MCCompLabel, int>>& labelCollector,
                                                 float commonMode)
 {
   const static Mapper& mapper = Mapper::instance();
-  static SAMPAProcessing& sampaProcessing = SAMPAProcessing::instance();
   const PadPos pad = mapper.padPos(globalPad);
-  static std::vector<std::pair<MCCompLabel, int>> labelCollector; // static workspace container for sorting
 
   /// The charge accumulated on that pad is converted into ADC counts, saturation of the SAMPA is applied and a Digit
   /// is created in written out
@@ -16,6 +16,9 @@
 #ifndef ALICEO2_TPC_DigitTime_H_
 #define ALICEO2_TPC_DigitTime_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "TPCBase/Mapper.h"
 #include "TPCSimulation/DigitGlobalPad.h"
 #include "SimulationDataFormat/LabelContainer.h"
@@ -70,18 +73,22 @@ class DigitTime
   /// \param commonModeOutput Output container for common mode
   /// \param cru CRU ID
   /// \param timeBin Time bin
+  /// \param sampaProcessing SAMPA processing used to make the signal
+  /// \param labelCollector Workspace container for sorting the MC labels
   /// \param commonMode Common mode value of that specific ROC
   template <DigitzationMode MODE>
   void fillOutputContainer(std::vector<Digit>& output, dataformats::MCTruthContainer<MCCompLabel>& mcTruth,
-                           std::vector<CommonMode>& commonModeOutput, const Sector& sector, TimeBin timeBin, float commonMode = 0.f);
+                           std::vector<CommonMode>& commonModeOutput, const Sector& sector, TimeBin timeBin,
+                           SAMPAProcessing& sampaProcessing, std::vector<std::pair<MCCompLabel, int>>& labelCollector,
+                           float commonMode = 0.f);
 
  private:
   std::array<float, GEMSTACKSPERSECTOR> mCommonMode;                 ///< Common mode container - 4 GEM ROCs per sector
   std::array<DigitGlobalPad, Mapper::getPadsInSector()> mGlobalPads; ///< Pad Container for the ADC value
+  std::vector<GlobalPadNumber> mOccupiedPads;                        ///< Pads with a digit in this time bin, in order of appearance
   int mDigitCounter = 0;                                             ///< counts the number of digits in this timebin
 
   o2::dataformats::LabelContainer<std::pair<MCCompLabel, int>, false> mLabels;
-  // std::deque<int> mOccupiedPads; // iterable container of occupied pads
 };
 
 inline DigitTime::DigitTime() : mCommonMode(), mGlobalPads()
@@ -96,7 +103,7 @@ inline void DigitTime::addDigit(const MCCompLabel& label, const CRU& cru, Global
   if (paddigit.getID() == -1) {
     // this means we have a new digit
     paddigit.setID(mDigitCounter++);
-    // could also register this pad in a vector of digits
+    mOccupiedPads.emplace_back(globalPad);
   }
   paddigit.addDigit(label, signal, mLabels);
   mCommonMode[cru.gemStack()] += signal;
@@ -104,9 +111,13 @@ inline void DigitTime::addDigit(const MCCompLabel& label, const CRU& cru, Global
 
 inline void DigitTime::reset()
 {
-  for (auto& pad : mGlobalPads) {
-    pad.reset();
+  /// only the occupied pads need to be reset, the allocated memory is kept for the next use of the time bin
+  for (auto globalPad : mOccupiedPads) {
+    mGlobalPads[globalPad].reset();
   }
+  mOccupiedPads.clear();
+  mLabels.clear();
+  mDigitCounter = 0;
   mCommonMode.fill(0.f);
 }
 
@@ -121,22 +132,24 @@ inline float DigitTime::getCommonMode(const GEMstack& gemstack) const
 template <DigitzationMode MODE>
 inline void DigitTime::fillOutputContainer(std::vector<Digit>& output, dataformats::MCTruthContainer<MCCompLabel>& mcTruth,
                                            std::vector<CommonMode>& commonModeOutput, const Sector& sector, TimeBin timeBin,
+                                           SAMPAProcessing& sampaProcessing, std::vector<std::pair<MCCompLabel, int>>& labelCollector,
                                            float commonMode)
 {
   static Mapper& mapper = Mapper::instance();
-  GlobalPadNumber globalPad = 0;
   for (size_t i = 0; i < mCommonMode.size(); ++i) {
     const float cm = getCommonMode(GEMstack(i));
     if (cm > 0.) {
       commonModeOutput.push_back({cm, timeBin, static_cast<unsigned char>(i)});
     }
   }
-  for (auto& pad : mGlobalPads) {
+  /// loop only over the occupied pads, in ascending pad order
+  std::sort(mOccupiedPads.begin(), mOccupiedPads.end());
+  for (auto globalPad : mOccupiedPads) {
+    auto& pad = mGlobalPads[globalPad];
     if (pad.getChargePad() > 0.) {
       const CRU cru = mapper.getCRU(sector, globalPad);
-      pad.fillOutputContainer<MODE>(output, mcTruth, cru, timeBin, globalPad, mLabels, getCommonMode(cru));
+      pad.fillOutputContainer<MODE>(output, mcTruth, cru, timeBin, globalPad, mLabels, sampaProcessing, labelCollector, getCommonMode(cru));
     }
-    ++globalPad;
   }
 }
 } // namespace tpc
@@ -17,6 +17,9 @@
 #define ALICEO2_TPC_Digitizer_H_
 
 #include "TPCSimulation/DigitContainer.h"
+#include "TPCSimulation/ElectronTransport.h"
+#include "TPCSimulation/GEMAmplification.h"
+#include "TPCSimulation/SAMPAProcessing.h"
 #include "TPCSimulation/Point.h"
 #include "TPCSpaceCharge/SpaceCharge.h"
 
@@ -66,6 +69,10 @@ class Digitizer
   /// Initializer
   void init();
 
+  /// Use private instances of the electron transport, GEM amplification and SAMPA processing, with their own
+  /// random number rings, instead of the shared ones. This allows several digitizers to run concurrently
+  void usePrivateRandomStreams();
+
   /// Process a single hit group
   /// \param hits Container with TPC hit groups
   /// \param eventID ID of the event to be processed
@@ -126,12 +133,16 @@ class Digitizer
   void setUseSCDistortions(TFile& finp);
 
  private:
-  DigitContainer mDigitContainer;    ///< Container for the Digits
-  std::unique_ptr<SC> mSpaceCharge;  ///< Handler of space-charge distortions
-  Sector mSector = -1;               ///< ID of the currently processed sector
-  double mEventTime = 0.f;           ///< Time of the currently processed event
-  double mOutputDigitTimeOffset = 0; ///< Time of the first IR sampled in the digitizer
-  bool mIsContinuous;                ///< Switch for continuous readout
+  DigitContainer mDigitContainer;                        ///< Container for the Digits
+  std::unique_ptr<SC> mSpaceCharge;                      ///< Handler of space-charge distortions
+  std::unique_ptr<ElectronTransport> mElectronTransport; ///< Private electron transport, if not using the shared one
+  std::unique_ptr<GEMAmplification> mGEMAmplification;   ///< Private GEM amplification, if not using the shared one
+  std::unique_ptr<SAMPAProcessing> mSAMPAProcessing;     ///< Private SAMPA processing, if not using the shared one
+  std::vector<float> mSignalArray;                       ///< Workspace container for the shaped signal
+  Sector mSector = -1;                                   ///< ID of the currently processed sector
+  double mEventTime = 0.f;                               ///< Time of the currently processed event
+  double mOutputDigitTimeOffset = 0;                     ///< Time of the first IR sampled in the digitizer
+  bool mIsContinuous;                                    ///< Switch for continuous readout
   bool mUseSCDistortions = false; ///< Flag to switch on the use of space-charge distortions
   ClassDefNV(Digitizer, 1);
 };
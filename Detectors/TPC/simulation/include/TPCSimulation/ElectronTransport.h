@@ -41,6 +41,11 @@ class ElectronTransport
     return electronTransport;
   }
 
+  /// Constructor
+  /// Apart from the shared instance(), independent instances (with their own random number rings) can be created
+  /// for concurrent digitization in several threads
+  ElectronTransport();
+
   /// Destructor
   ~ElectronTransport() = default;
 
@@ -72,8 +77,6 @@ class ElectronTransport
   float getDriftTime(float zPos, float signChange = 1.f) const;
 
  private:
-  ElectronTransport();
-
   /// Circular random buffer containing random values of the Gauss distribution to take into account diffusion of the
   /// electrons
   math_utils::RandomRing<> mRandomGaus;
@@ -43,6 +43,11 @@ class GEMAmplification
     return gemAmplification;
   }
 
+  /// Constructor
+  /// Apart from the shared instance(), independent instances (with their own random number rings) can be created
+  /// for concurrent digitization in several threads
+  GEMAmplification();
+
   /// Destructor
   ~GEMAmplification() = default;
 
@@ -90,8 +95,6 @@ class GEMAmplification
   int getGEMMultiplication(int nElectrons, int GEM);
 
  private:
-  GEMAmplification();
-
   /// Circular random buffer containing random Gaus values for gain fluctuation if the number of electrons is larger
   /// (central limit theorem)
   math_utils::RandomRing<> mRandomGaus;
@@ -45,6 +45,12 @@ class SAMPAProcessing
     static SAMPAProcessing sampaProcessing;
     return sampaProcessing;
   }
+
+  /// Constructor
+  /// Apart from the shared instance(), independent instances (with their own random number ring for the noise) can
+  /// be created for concurrent digitization in several threads
+  SAMPAProcessing();
+
   /// Destructor
   ~SAMPAProcessing() = default;
 
@@ -125,8 +131,6 @@ class SAMPAProcessing
   float getPedestal(const int sector, const int globalPadInSector) const;
 
  private:
-  SAMPAProcessing();
-
   const ParameterGas* mGasParam;         ///< Caching of the parameter class to avoid multiple CDB calls
   const ParameterDetector* mDetParam;    ///< Caching of the parameter class to avoid multiple CDB calls
   const ParameterElectronics* mEleParam; ///< Caching of the parameter class to avoid multiple CDB calls
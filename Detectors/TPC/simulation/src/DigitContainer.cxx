@@ -28,7 +28,8 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
   const auto digitizationMode = eleParam.DigiMode;
   int nProcessedTimeBins = 0;
   TimeBin timeBin = (isContinuous) ? mFirstTimeBin : 0;
-  for (auto& time : mTimeBins) {
+  for (size_t iTimeBin = 0; iTimeBin < mNTimeBins; ++iTimeBin) {
+    auto& time = getTimeBin(iTimeBin);
     /// the time bins between the last event and the timing of this event are uncorrelated and can be written out
     /// OR the readout is triggered (i.e. not continuous) and we can dump everything in any case, as long it is within one drift time interval
     if ((nProcessedTimeBins + mFirstTimeBin < eventTimeBin) || !isContinuous || finalFlush) {
@@ -39,22 +40,24 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
 
       switch (digitizationMode) {
         case DigitzationMode::FullMode: {
-          time.fillOutputContainer<DigitzationMode::FullMode>(output, mcTruth, commonModeOutput, sector, timeBin);
+          time.fillOutputContainer<DigitzationMode::FullMode>(output, mcTruth, commonModeOutput, sector, timeBin, *mSAMPAProcessing, mLabelCollector);
           break;
         }
         case DigitzationMode::SubtractPedestal: {
-          time.fillOutputContainer<DigitzationMode::SubtractPedestal>(output, mcTruth, commonModeOutput, sector, timeBin);
+          time.fillOutputContainer<DigitzationMode::SubtractPedestal>(output, mcTruth, commonModeOutput, sector, timeBin, *mSAMPAProcessing, mLabelCollector);
           break;
         }
         case DigitzationMode::NoSaturation: {
-          time.fillOutputContainer<DigitzationMode::NoSaturation>(output, mcTruth, commonModeOutput, sector, timeBin);
+          time.fillOutputContainer<DigitzationMode::NoSaturation>(output, mcTruth, commonModeOutput, sector, timeBin, *mSAMPAProcessing, mLabelCollector);
           break;
         }
         case DigitzationMode::PropagateADC: {
-          time.fillOutputContainer<DigitzationMode::PropagateADC>(output, mcTruth, commonModeOutput, sector, timeBin);
+          time.fillOutputContainer<DigitzationMode::PropagateADC>(output, mcTruth, commonModeOutput, sector, timeBin, *mSAMPAProcessing, mLabelCollector);
           break;
         }
       }
+      /// the time bin is written out and can be reused
+      time.reset();
     } else {
       break;
     }
@@ -62,8 +65,7 @@ void DigitContainer::fillOutputContainer(std::vector<Digit>& output,
   }
   if (nProcessedTimeBins > 0) {
     mFirstTimeBin += nProcessedTimeBins;
-    while (nProcessedTimeBins--) {
-      mTimeBins.pop_front();
-    }
+    mFirstBin = (mFirstBin + nProcessedTimeBins) % mTimeBins.size();
+    mNTimeBins -= nProcessedTimeBins;
   }
 }
@@ -34,6 +34,14 @@ ClassImp(o2::tpc::Digitizer);
 
 using namespace o2::tpc;
 
+void Digitizer::usePrivateRandomStreams()
+{
+  mElectronTransport = std::make_unique<ElectronTransport>();
+  mGEMAmplification = std::make_unique<GEMAmplification>();
+  mSAMPAProcessing = std::make_unique<SAMPAProcessing>();
+  mDigitContainer.setSAMPAProcessing(*mSAMPAProcessing);
+}
+
 void Digitizer::init()
 {
   // Calculate distortion lookup tables if initial space-charge density is provided
@@ -50,16 +58,16 @@ void Digitizer::process(const std::vector<o2::tpc::HitGroup>& hits,
   auto& eleParam = ParameterElectronics::Instance();
   auto& gemParam = ParameterGEM::Instance();
 
-  static GEMAmplification& gemAmplification = GEMAmplification::instance();
+  GEMAmplification& gemAmplification = mGEMAmplification ? *mGEMAmplification : GEMAmplification::instance();
   gemAmplification.updateParameters();
-  static ElectronTransport& electronTransport = ElectronTransport::instance();
+  ElectronTransport& electronTransport = mElectronTransport ? *mElectronTransport : ElectronTransport::instance();
   electronTransport.updateParameters();
-  static SAMPAProcessing& sampaProcessing = SAMPAProcessing::instance();
+  SAMPAProcessing& sampaProcessing = mSAMPAProcessing ? *mSAMPAProcessing : SAMPAProcessing::instance();
   sampaProcessing.updateParameters();
 
   const int nShapedPoints = eleParam.NShapedPoints;
   const auto amplificationMode = gemParam.AmplMode;
-  static std::vector<float> signalArray;
+  auto& signalArray = mSignalArray;
   signalArray.resize(nShapedPoints);
 
   /// Reserve space in the digit container for the current event
@@ -158,7 +166,7 @@ void Digitizer::flush(std::vector<o2::tpc::Digit>& digits,
                       std::vector<o2::tpc::CommonMode>& commonModeOutput,
                       bool finalFlush)
 {
-  static SAMPAProcessing& sampaProcessing = SAMPAProcessing::instance();
+  SAMPAProcessing& sampaProcessing = mSAMPAProcessing ? *mSAMPAProcessing : SAMPAProcessing::instance();
   mDigitContainer.fillOutputContainer(digits, labels, commonModeOutput, mSector, sampaProcessing.getTimeBinFromTime(mEventTime - mOutputDigitTimeOffset), mIsContinuous, finalFlush);
 }
 
@@ -195,7 +203,7 @@ void Digitizer::setUseSCDistortions(TFile& finp)
 
 void Digitizer::setStartTime(double time)
 {
-  static SAMPAProcessing& sampaProcessing = SAMPAProcessing::instance();
+  SAMPAProcessing& sampaProcessing = mSAMPAProcessing ? *mSAMPAProcessing : SAMPAProcessing::instance();
   sampaProcessing.updateParameters();
   mDigitContainer.setStartTime(sampaProcessing.getTimeBinFromTime(time - mOutputDigitTimeOffset));
 }
@@ -166,5 +166,46 @@ BOOST_AUTO_TEST_CASE(DigitContainer_test2)
     BOOST_CHECK_CLOSE(commonMode[i].getCommonMode(), chargeSum[i] / nPads, 1E-6);
   }
 }
+
+/// \brief Test of the DigitContainer
+/// The time bins written out in continuous mode are reused for later time bins and we check that no charge or
+/// MC label of the previous time bin survives
+BOOST_AUTO_TEST_CASE(DigitContainer_test3)
+{
+  auto& cdb = CDBInterface::instance();
+  cdb.setUseDefaults();
+  o2::conf::ConfigurableParam::updateFromString("TPCEleParam.DigiMode=3"); // propagate the ADC values, otherwise the computation get complicated
+  const Mapper& mapper = Mapper::instance();
+  DigitContainer digitContainer;
+  dataformats::MCTruthContainer<MCCompLabel> mMCTruthArray;
+  std::vector<Digit> mDigitsArray;
+  std::vector<o2::tpc::CommonMode> commonMode;
+  digitContainer.reset();
+
+  const CRU cru(0);
+  const GlobalPadNumber globalPad = mapper.getPadNumberInROC(PadROCPos(cru.roc(), PadPos(12, 1)));
+  const TimeBin eventTimeBin = 100;
+
+  // first digit, written out when the next event comes
+  digitContainer.addDigit(MCCompLabel(22, 1, 0, false), cru, 10, globalPad, 60);
+  digitContainer.fillOutputContainer(mDigitsArray, mMCTruthArray, commonMode, 0, eventTimeBin, true, false);
+  BOOST_CHECK(mDigitsArray.size() == 1);
+
+  // second digit on the same pad, stored in the time bin container used by the first one
+  digitContainer.reserve(eventTimeBin);
+  const TimeBin timeBin = digitContainer.size() + 10;
+  digitContainer.addDigit(MCCompLabel(3, 250, 0, false), cru, timeBin, globalPad, 100);
+  digitContainer.fillOutputContainer(mDigitsArray, mMCTruthArray, commonMode, 0, 0, true, true);
+
+  BOOST_CHECK(mDigitsArray.size() == 2);
+  BOOST_CHECK(mDigitsArray[0].getTimeStamp() == 10);
+  BOOST_CHECK_CLOSE(mDigitsArray[0].getChargeFloat(), 60, 1E-6);
+  BOOST_CHECK(mDigitsArray[1].getTimeStamp() == timeBin);
+  BOOST_CHECK_CLOSE(mDigitsArray[1].getChargeFloat(), 100, 1E-6);
+  gsl::span<const o2::MCCompLabel> mcArray = mMCTruthArray.getLabels(1);
+  BOOST_CHECK(mcArray.size() == 1);
+  BOOST_CHECK(mcArray[0].getTrackID() == 3);
+  BOOST_CHECK(mcArray[0].getEventID() == 250);
+}
 } // namespace tpc
 } // namespace o2
@@ -0,0 +1,132 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file testTPCDigitizer.cxx
+/// \brief This task tests the digitization of sectors with private random streams
+
+#define BOOST_TEST_MODULE Test TPC Digitizer
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "DataFormatsTPC/Digit.h"
+#include "TPCSimulation/Digitizer.h"
+#include "TPCSimulation/Point.h"
+#include "TPCBase/CDBInterface.h"
+
+#include "TRandom.h"
+
+namespace o2
+{
+namespace tpc
+{
+
+constexpr int NTestSectors = 4;
+
+/// hits of a few tracks crossing the A-side sector in its middle
+std::vector<HitGroup> createHits(int sector)
+{
+  std::vector<HitGroup> hits;
+  const float phi = (sector * 20.f + 10.f) * M_PI / 180.f;
+  for (int track = 0; track < 5; ++track) {
+    auto& hitGroup = hits.emplace_back(track);
+    for (float r = 90.f; r < 240.f; r += 2.f) {
+      hitGroup.addHit(r * std::cos(phi), r * std::sin(phi), 20.f + 30.f * track, 0.f, 50);
+    }
+  }
+  return hits;
+}
+
+/// digitize the sectors one after the other with the same digitizer
+std::vector<std::vector<Digit>> digitizeSectors(Digitizer& digitizer, std::vector<int> const& sectors)
+{
+  std::vector<std::vector<Digit>> result;
+  for (auto sector : sectors) {
+    digitizer.setSector(sector);
+    digitizer.init();
+    digitizer.setOutputDigitTimeOffset(0.);
+    digitizer.setStartTime(0.);
+    digitizer.setEventTime(0.);
+    digitizer.process(createHits(sector), 0, 0);
+    auto& digits = result.emplace_back();
+    o2::dataformats::MCTruthContainer<o2::MCCompLabel> labels;
+    std::vector<CommonMode> commonMode;
+    digitizer.flush(digits, labels, commonMode, true);
+  }
+  return result;
+}
+
+/// create the digitizers the way the digitizer device does, in the same order from the same seed
+std::array<std::unique_ptr<Digitizer>, 2> createDigitizers()
+{
+  gRandom->SetSeed(1234);
+  std::array<std::unique_ptr<Digitizer>, 2> digitizers;
+  for (auto& digitizer : digitizers) {
+    digitizer = std::make_unique<Digitizer>();
+    digitizer->usePrivateRandomStreams();
+    digitizer->setContinuousReadout(true);
+  }
+  return digitizers;
+}
+
+void checkSameDigits(std::vector<Digit> const& digits, std::vector<Digit> const& reference)
+{
+  BOOST_REQUIRE_EQUAL(digits.size(), reference.size());
+  for (size_t i = 0; i < digits.size(); ++i) {
+    BOOST_CHECK_EQUAL(digits[i].getCRU(), reference[i].getCRU());
+    BOOST_CHECK_EQUAL(digits[i].getRow(), reference[i].getRow());
+    BOOST_CHECK_EQUAL(digits[i].getPad(), reference[i].getPad());
+    BOOST_CHECK_EQUAL(digits[i].getTimeStamp(), reference[i].getTimeStamp());
+    BOOST_CHECK_EQUAL(digits[i].getChargeFloat(), reference[i].getChargeFloat());
+  }
+}
+
+/// \brief Test of the static assignment of the sectors to the digitizers
+/// The sectors assigned to each digitizer are digitized once with the digitizers one after the other, and once
+/// with the digitizers running concurrently, as the threads of the digitizer device do. The digits have to be the
+/// same: with private random streams they depend only on the sectors a digitizer processes and on their order.
+BOOST_AUTO_TEST_CASE(Digitizer_privateStreams)
+{
+  auto& cdb = CDBInterface::instance();
+  cdb.setUseDefaults();
+
+  std::array<std::vector<int>, 2> assignedSectors;
+  for (int sector = 0; sector < NTestSectors; ++sector) {
+    assignedSectors[sector % 2].push_back(sector);
+  }
+
+  auto sequential = createDigitizers();
+  std::array<std::vector<std::vector<Digit>>, 2> reference;
+  for (int i = 0; i < 2; ++i) {
+    reference[i] = digitizeSectors(*sequential[i], assignedSectors[i]);
+  }
+
+  auto concurrent = createDigitizers();
+  std::array<std::vector<std::vector<Digit>>, 2> digits;
+  std::thread other([&]() { digits[1] = digitizeSectors(*concurrent[1], assignedSectors[1]); });
+  digits[0] = digitizeSectors(*concurrent[0], assignedSectors[0]);
+  other.join();
+
+  for (int i = 0; i < 2; ++i) {
+    BOOST_REQUIRE_EQUAL(digits[i].size(), reference[i].size());
+    for (size_t iSector = 0; iSector < digits[i].size(); ++iSector) {
+      BOOST_CHECK(reference[i][iSector].size() > 0);
+      checkSameDigits(digits[i][iSector], reference[i][iSector]);
+    }
+  }
+}
+
+} // namespace tpc
+} // namespace o2
@@ -97,6 +97,9 @@ class PVertexer
     mITSROFrameLengthMUS = v;
   }
 
+  void setNThreads(int n) { mNThreads = n > 0 ? n : 1; }
+  int getNThreads() const { return mNThreads; }
+
  private:
   static constexpr int DBS_UNDEF = -2, DBS_NOISE = -1, DBS_INCHECK = -10;
 
@@ -123,6 +126,7 @@ class PVertexer
 
   int findVertices(const VertexingInput& input, std::vector<PVertex>& vertices, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs);
   void reAttach(std::vector<PVertex>& vertices, std::vector<int>& timeSort, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs);
+  void mergeOutputs(std::vector<VertexingOutput>& outputs, std::vector<PVertex>& vertices, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs);
 
   std::pair<int, int> getBestIR(const PVertex& vtx, const gsl::span<o2::InteractionRecord> bcData, int& currEntry) const;
 
@@ -142,6 +146,7 @@ class PVertexer
   float mITSROFrameLengthMUS = 0;           ///< ITS readout time span in \mus
   float mBz = 0.;                          ///< mag.field at beam line
   bool mValidateWithIR = false;            ///< require vertex validation with InteractionRecords (if available)
+  int mNThreads = 1;                       ///< number of threads for time clusters processing
 
   o2::InteractionRecord mStartIR{0, 0}; ///< IR corresponding to the start of the TF
 
@@ -16,6 +16,7 @@
 #ifndef O2_PVERTEXER_HELPERS_H
 #define O2_PVERTEXER_HELPERS_H
 
+#include <vector>
 #include "gsl/span"
 #include "ReconstructionDataFormats/PrimaryVertex.h"
 #include "ReconstructionDataFormats/Track.h"
@@ -42,6 +43,13 @@ struct VertexingInput {
   float scaleSigma2 = 10;
 };
 
+///< vertices and their tracks found for a part of the input (e.g. single time cluster)
+struct VertexingOutput {
+  std::vector<PVertex> vertices;
+  std::vector<uint32_t> trackIDs;
+  std::vector<V2TRef> v2tRefs;
+};
+
 ///< weights and scaling params for current vertex
 struct VertexSeed : public PVertex {
   double wghSum = 0.;                                                                              // sum of tracks weights
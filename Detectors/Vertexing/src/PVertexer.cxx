@@ -22,6 +22,10 @@
 #include "CommonUtils/StringUtils.h" // RS REM
 #include <TH2F.h>
 
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
 using namespace o2::vertexing;
 
 constexpr float PVertexer::kAlmost0F;
@@ -40,15 +44,38 @@ int PVertexer::runVertexing(const gsl::span<o2d::GlobalTrackID> gids, const gsl:
   std::vector<float> validationTimes;
   std::vector<o2::MCEventLabel> lblVtxLoc;
 
-  for (auto tc : mTimeZClusters) {
-    VertexingInput inp;
-    inp.idRange = gsl::span<int>(tc.trackIDs);
-    inp.scaleSigma2 = mPVParams->iniScale2;
-    inp.timeEst = tc.timeEst;
+  int nClusters = mTimeZClusters.size();
+#if defined(WITH_OPENMP) && !defined(_PV_DEBUG_TREE_)
+  if (mNThreads > 1 && nClusters > 1) {
+    // time clusters have no tracks in common, so they can be processed in parallel. The output of every cluster
+    // is stored separately and merged in the clusters order to get the same result as in the sequential processing
+    std::vector<VertexingOutput> clusOutputs(nClusters);
+    omp_set_num_threads(mNThreads);
+    int dynGrp = std::min(4, std::max(1, mNThreads / 2));
+#pragma omp parallel for schedule(dynamic, dynGrp)
+    for (int ic = 0; ic < nClusters; ic++) {
+      auto& tc = mTimeZClusters[ic];
+      VertexingInput inp;
+      inp.idRange = gsl::span<int>(tc.trackIDs);
+      inp.scaleSigma2 = mPVParams->iniScale2;
+      inp.timeEst = tc.timeEst;
+      auto& out = clusOutputs[ic];
+      findVertices(inp, out.vertices, out.trackIDs, out.v2tRefs);
+    }
+    mergeOutputs(clusOutputs, verticesLoc, trackIDs, v2tRefsLoc);
+  } else
+#endif
+  {
+    for (auto tc : mTimeZClusters) {
+      VertexingInput inp;
+      inp.idRange = gsl::span<int>(tc.trackIDs);
+      inp.scaleSigma2 = mPVParams->iniScale2;
+      inp.timeEst = tc.timeEst;
 #ifdef _PV_DEBUG_TREE_
-    doDBScanDump(inp, lblTracks);
+      doDBScanDump(inp, lblTracks);
 #endif
-    findVertices(inp, verticesLoc, trackIDs, v2tRefsLoc);
+      findVertices(inp, verticesLoc, trackIDs, v2tRefsLoc);
+    }
   }
 
   // sort in time
@@ -446,11 +473,11 @@ void PVertexer::reAttach(std::vector<PVertex>& vertices, std::vector<int>& timeS
   v2tRefs.clear();
   trackIDs.clear();
   std::vector<PVertex> verticesUpd;
-  for (int ivt = 0; ivt < nvtOrig; ivt++) {
+  auto refitVertex = [this, &vertices](int ivt, std::vector<PVertex>& vtxOut, std::vector<V2TRef>& refsOut, std::vector<uint32_t>& idsOut) {
     auto& clusZT = mTimeZClusters[ivt];
     auto& vtx = vertices[ivt];
     if (clusZT.trackIDs.size() < mPVParams->minTracksPerVtx) {
-      continue;
+      return;
     }
     VertexingInput inp;
     inp.idRange = gsl::span<int>(clusZT.trackIDs);
@@ -458,9 +485,27 @@ void PVertexer::reAttach(std::vector<PVertex>& vertices, std::vector<int>& timeS
     inp.timeEst = vtx.getTimeStamp();
     if (!findVertex(inp, vtx)) {
       vtx.setNContributors(0);
-      continue;
+      return;
+    }
+    finalizeVertex(inp, vtx, vtxOut, refsOut, idsOut);
+  };
+#if defined(WITH_OPENMP) && !defined(_PV_DEBUG_TREE_)
+  if (mNThreads > 1 && nvtOrig > 1) { // every track was reattached to a single vertex, the refits are independent
+    std::vector<VertexingOutput> vtxOutputs(nvtOrig);
+    omp_set_num_threads(mNThreads);
+    int dynGrp = std::min(4, std::max(1, mNThreads / 2));
+#pragma omp parallel for schedule(dynamic, dynGrp)
+    for (int ivt = 0; ivt < nvtOrig; ivt++) {
+      auto& out = vtxOutputs[ivt];
+      refitVertex(ivt, out.vertices, out.v2tRefs, out.trackIDs);
+    }
+    mergeOutputs(vtxOutputs, verticesUpd, trackIDs, v2tRefs);
+  } else
+#endif
+  {
+    for (int ivt = 0; ivt < nvtOrig; ivt++) {
+      refitVertex(ivt, verticesUpd, v2tRefs, trackIDs);
     }
-    finalizeVertex(inp, vtx, verticesUpd, v2tRefs, trackIDs);
   }
   // reorder in time since the time-stamp of vertices might have been changed
   vertices.swap(verticesUpd);
@@ -471,6 +516,24 @@ void PVertexer::reAttach(std::vector<PVertex>& vertices, std::vector<int>& timeS
   });
 }
 
+//___________________________________________________________________
+void PVertexer::mergeOutputs(std::vector<VertexingOutput>& outputs, std::vector<PVertex>& vertices, std::vector<uint32_t>& trackIDs, std::vector<V2TRef>& v2tRefs)
+{
+  // append vertices found for separate parts of the input to the global output, updating the references
+  for (auto& out : outputs) {
+    int vtxOffs = vertices.size(), trOffs = trackIDs.size(), nv = out.vertices.size();
+    for (int iv = 0; iv < nv; iv++) {
+      vertices.push_back(out.vertices[iv]);
+      v2tRefs.emplace_back(out.v2tRefs[iv].getFirstEntry() + trOffs, out.v2tRefs[iv].getEntries());
+    }
+    for (auto id : out.trackIDs) {
+      mTracksPool[id].vtxID += vtxOffs; // vertex ID was assigned w.r.t. the local output
+      trackIDs.push_back(id);
+    }
+    out = VertexingOutput{}; // release memory
+  }
+}
+
 //___________________________________________________________________
 void PVertexer::reduceDebris(std::vector<PVertex>& vertices, std::vector<int>& timeSort, const std::vector<o2::MCEventLabel>& lblVtx)
 {
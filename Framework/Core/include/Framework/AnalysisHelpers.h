@@ -512,6 +512,11 @@ struct Partition {
   {
   }
 
+  /// the copy is not bound to any table
+  Partition(Partition const& other) : filter{other.filter}
+  {
+  }
+
   void bindTable(T& table)
   {
     mFiltered.reset(getTableFromFilter(table, filter));
@@ -26,6 +26,10 @@
 #include "Framework/ExpressionHelpers.h"
 #include "Framework/CommonServices.h"
 
+#include <TList.h>
+
+#include <type_traits>
+
 namespace o2::framework
 {
 
@@ -152,6 +156,29 @@ struct OutputManager {
   {
     return true;
   }
+
+  /// Make a copy of the task, which processes part of the data in
+  /// a separate thread, write to its own outputs. Returns false if
+  /// the outputs cannot be written by concurrent copies.
+  template <typename ANY>
+  static bool detachThreadCopy(ANY&)
+  {
+    return true;
+  }
+
+  /// Prepare the outputs of a copy of the task for a new timeframe
+  template <typename ANY>
+  static bool prepareThreadCopy(ANY&, ANY&)
+  {
+    return true;
+  }
+
+  /// Add what a copy accumulated during the whole run to the original
+  template <typename ANY>
+  static bool mergeThreadCopy(ANY&, ANY&)
+  {
+    return true;
+  }
 };
 
 /// Produces specialization
@@ -176,6 +203,20 @@ struct OutputManager<Produces<TABLE>> {
   {
     return true;
   }
+  /// the rows are indexed by lastIndex(), which depends on all the rows written
+  /// before in the timeframe, thus tables cannot be produced by concurrent copies
+  static bool detachThreadCopy(Produces<TABLE>&)
+  {
+    return false;
+  }
+  static bool prepareThreadCopy(Produces<TABLE>&, Produces<TABLE>&)
+  {
+    return true;
+  }
+  static bool mergeThreadCopy(Produces<TABLE>&, Produces<TABLE>&)
+  {
+    return true;
+  }
 };
 
 /// HistogramRegistry specialization
@@ -202,6 +243,39 @@ struct OutputManager<HistogramRegistry> {
     context.outputs().snapshot(what.ref(), *(*what));
     return true;
   }
+
+  static bool detachThreadCopy(HistogramRegistry& copy)
+  {
+    copy.detachHistograms();
+    return true;
+  }
+
+  static bool prepareThreadCopy(HistogramRegistry&, HistogramRegistry&)
+  {
+    return true;
+  }
+
+  static bool mergeThreadCopy(HistogramRegistry& what, HistogramRegistry& copy)
+  {
+    what.merge(copy);
+    return true;
+  }
+};
+
+template <typename T, typename = void>
+struct is_mergeable : std::false_type {
+};
+
+template <typename T>
+struct is_mergeable<T, std::void_t<decltype(std::declval<T&>().Merge(std::declval<TCollection*>()))>> : std::true_type {
+};
+
+template <typename T, typename = void>
+struct is_resettable : std::false_type {
+};
+
+template <typename T>
+struct is_resettable<T, std::void_t<decltype(std::declval<T&>().Reset())>> : std::true_type {
 };
 
 /// OutputObj specialization
@@ -228,6 +302,44 @@ struct OutputManager<OutputObj<T>> {
     context.outputs().snapshot(what.ref(), *what);
     return true;
   }
+
+  /// objects which cannot be merged back are not filled concurrently
+  static bool detachThreadCopy(OutputObj<T>& copy)
+  {
+    if constexpr (is_mergeable<T>::value) {
+      if (copy.object) {
+        copy.object = std::shared_ptr<T>(static_cast<T*>(copy.object->Clone()));
+        if constexpr (is_resettable<T>::value) {
+          copy.object->Reset();
+        }
+      }
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  static bool prepareThreadCopy(OutputObj<T>&, OutputObj<T>&)
+  {
+    return true;
+  }
+
+  static bool mergeThreadCopy(OutputObj<T>& what, OutputObj<T>& copy)
+  {
+    if constexpr (is_mergeable<T>::value) {
+      if (!copy.object || copy.object == what.object) {
+        return true;
+      }
+      if (!what.object) {
+        what.setObject(copy.object);
+        return true;
+      }
+      TList list;
+      list.Add(copy.object.get());
+      what.object->Merge(&list);
+    }
+    return true;
+  }
 };
 
 /// Spawns specializations
@@ -274,6 +386,24 @@ struct OutputManager<Spawns<T>> {
   {
     return true;
   }
+
+  static bool detachThreadCopy(Spawns<T>&)
+  {
+    return true;
+  }
+
+  /// the spawned table is only read by the copies
+  static bool prepareThreadCopy(Spawns<T>& what, Spawns<T>& copy)
+  {
+    copy.extension = what.extension;
+    copy.table = what.table;
+    return true;
+  }
+
+  static bool mergeThreadCopy(Spawns<T>&, Spawns<T>&)
+  {
+    return true;
+  }
 };
 
 /// Builds specialization
@@ -324,6 +454,63 @@ struct OutputManager<Builds<T, P>> {
   {
     return true;
   }
+
+  static bool detachThreadCopy(Builds<T, P>&)
+  {
+    return true;
+  }
+
+  /// the built index is only read by the copies
+  static bool prepareThreadCopy(Builds<T, P>& what, Builds<T, P>& copy)
+  {
+    copy.table = what.table;
+    return true;
+  }
+
+  static bool mergeThreadCopy(Builds<T, P>&, Builds<T, P>&)
+  {
+    return true;
+  }
+};
+
+/// Service specialization
+template <typename T>
+struct OutputManager<Service<T>> {
+  static bool appendOutput(std::vector<OutputSpec>&, Service<T>&, uint32_t)
+  {
+    return false;
+  }
+
+  static bool prepare(ProcessingContext&, Service<T>&)
+  {
+    return false;
+  }
+
+  static bool finalize(ProcessingContext&, Service<T>&)
+  {
+    return true;
+  }
+
+  static bool postRun(EndOfStreamContext&, Service<T>&)
+  {
+    return true;
+  }
+
+  /// the copies would share the service, which is not known to be thread-safe
+  static bool detachThreadCopy(Service<T>&)
+  {
+    return false;
+  }
+
+  static bool prepareThreadCopy(Service<T>&, Service<T>&)
+  {
+    return true;
+  }
+
+  static bool mergeThreadCopy(Service<T>&, Service<T>&)
+  {
+    return true;
+  }
 };
 
 template <typename T>
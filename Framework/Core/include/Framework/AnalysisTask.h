@@ -13,6 +13,8 @@
 #define FRAMEWORK_ANALYSIS_TASK_H_
 
 #include "Framework/AnalysisManagers.h"
+#include "Framework/ArrowTableSlicingCache.h"
+#include "Framework/ProcessThreadPool.h"
 #include "Framework/AlgorithmSpec.h"
 #include "Framework/CallbackService.h"
 #include "Framework/ConfigContext.h"
@@ -32,6 +34,7 @@
 #include <arrow/compute/kernel.h>
 #include <arrow/table.h>
 #include <gandiva/node.h>
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 #include <memory>
@@ -52,6 +55,66 @@ namespace o2::framework
 struct AnalysisTask {
 };
 
+/// Call @a l on each member of the @a task together with the
+/// same member of a @a copy of it. Returns false if any call does.
+template <typename L, typename T>
+bool applyToThreadCopy(L l, T& task, T& copy)
+{
+  auto members = homogeneous_apply_refs([](auto& x) -> void* { return const_cast<void*>(static_cast<void const*>(&x)); }, copy);
+  size_t index = 0;
+  auto results = homogeneous_apply_refs([&](auto& x) -> bool { return l(x, *static_cast<std::remove_reference_t<decltype(x)>*>(members[index++])); }, task);
+  return std::all_of(results.begin(), results.end(), [](bool result) { return result; });
+}
+
+/// The copies of a task which process part of the groups of its process
+/// functions, and the threads they run in. Both are kept for the whole run.
+template <typename T>
+struct ThreadCopies {
+  std::vector<std::shared_ptr<T>> copies;
+  std::shared_ptr<ProcessThreadPool> pool;
+
+  bool empty() const
+  {
+    return copies.empty();
+  }
+};
+
+/// Make the copies of the initialised @a task needed to process its groups in
+/// @a nThreads threads. No copies are made, and the task is processed in a single
+/// thread, if it cannot be copied or if any of its members cannot be used concurrently.
+/// Every copy gets its own copy of the members of the task, which are split as follows:
+/// - HistogramRegistry and mergeable OutputObj get their own empty objects, merged into
+///   the ones of the task at the end of stream;
+/// - Spawns and Builds tables, configurables and filters are only read by the copies;
+/// - partitions are bound by every copy to its own copy of the tables;
+/// - any other member (e.g. a counter) is copied after init() and is NOT merged back, the
+///   values accumulated by the copies are lost.
+/// Tasks with Produces (the rows are indexed in the order they are written in the timeframe),
+/// with Service (shared by the copies) or with OutputObj without Merge() are not copied.
+template <typename T>
+ThreadCopies<T> makeThreadCopies(T& task, int nThreads)
+{
+  ThreadCopies<T> result;
+  if (nThreads <= 1) {
+    return result;
+  }
+  if constexpr (std::is_copy_constructible_v<T>) {
+    for (auto i = 1; i < nThreads; ++i) {
+      auto copy = std::make_shared<T>(task);
+      auto detached = homogeneous_apply_refs([](auto& x) { return OutputManager<std::decay_t<decltype(x)>>::detachThreadCopy(x); }, *copy.get());
+      if (std::find(detached.begin(), detached.end(), false) != detached.end()) {
+        LOG(WARN) << "Some outputs or services of the task cannot be used concurrently, processing in a single thread";
+        return {};
+      }
+      result.copies.push_back(copy);
+    }
+    result.pool = std::make_shared<ProcessThreadPool>(result.copies.size());
+  } else {
+    LOG(WARN) << "The task cannot be copied, processing in a single thread";
+  }
+  return result;
+}
+
 // Helper struct which builds a DataProcessorSpec from
 // the contents of an AnalysisTask...
 
@@ -233,9 +296,17 @@ struct AnalysisDataProcessorBuilder {
   template <typename G, typename... A>
   struct GroupSlicer {
     using grouping_t = std::decay_t<G>;
+    /// the slicing of the associated tables is taken from the @a cache, shared
+    /// by all the process() functions in the timeframe
+    GroupSlicer(G& gt, std::tuple<A...>& at, ArrowTableSlicingCache& cache)
+      : max{gt.size()},
+        mBegin{GroupSlicerIterator(gt, at, cache)}
+    {
+    }
+
     GroupSlicer(G& gt, std::tuple<A...>& at)
       : max{gt.size()},
-        mBegin{GroupSlicerIterator(gt, at)}
+        mBegin{GroupSlicerIterator(gt, at, mOwnCache)}
     {
     }
 
@@ -274,7 +345,7 @@ struct AnalysisDataProcessorBuilder {
         }
       }
 
-      GroupSlicerIterator(G& gt, std::tuple<A...>& at)
+      GroupSlicerIterator(G& gt, std::tuple<A...>& at, ArrowTableSlicingCache& cache)
         : mAt{&at},
           mGroupingElement{gt.begin()},
           position{0}
@@ -290,17 +361,10 @@ struct AnalysisDataProcessorBuilder {
           using xt = std::decay_t<decltype(x)>;
           constexpr auto index = framework::has_type_at_v<std::decay_t<decltype(x)>>(associated_pack_t{});
           if (x.size() != 0 && hasIndexTo<std::decay_t<G>>(typename xt::persistent_columns_t{})) {
-            auto result = o2::framework::sliceByColumn(indexColumnName.c_str(),
-                                                       x.asArrowTable(),
-                                                       static_cast<int32_t>(gt.tableSize()),
-                                                       &groups[index],
-                                                       &offsets[index],
-                                                       &sizes[index]);
-            if (result.ok() == false) {
-              throw runtime_error("Cannot split collection");
-            }
-            if (groups[index].size() > gt.tableSize()) {
-              throw runtime_error_f("Splitting collection resulted in a larger group number (%d) than there is rows in the grouping table (%d).", groups[index].size(), gt.tableSize());
+            tables[index] = x.asArrowTable();
+            slices[index] = &cache.getSlices(indexColumnName, tables[index], static_cast<int32_t>(gt.tableSize()));
+            if (slices[index]->sizes.size() > gt.tableSize()) {
+              throw runtime_error_f("Splitting collection resulted in a larger group number (%d) than there is rows in the grouping table (%d).", slices[index]->sizes.size(), gt.tableSize());
             };
           }
         };
@@ -317,7 +381,6 @@ struct AnalysisDataProcessorBuilder {
             constexpr auto index = framework::has_type_at_v<std::decay_t<decltype(x)>>(associated_pack_t{});
             selections[index] = &x.getSelectedRows();
             starts[index] = selections[index]->begin();
-            offsets[index].push_back(std::get<xt>(at).tableSize());
           }
         };
         std::apply(
@@ -402,25 +465,25 @@ struct AnalysisDataProcessorBuilder {
           } else {
             pos = position;
           }
+          auto offset = slices[index]->offsets[pos];
+          auto size = slices[index]->sizes[pos];
+          auto groupedElementsTable = tables[index]->Slice(offset, size);
           if constexpr (soa::is_soa_filtered_t<std::decay_t<A1>>::value) {
-            auto groupedElementsTable = arrow::util::get<std::shared_ptr<arrow::Table>>(((groups[index])[pos]).value);
-
             // for each grouping element we need to slice the selection vector
-            auto start_iterator = std::lower_bound(starts[index], selections[index]->end(), (offsets[index])[pos]);
-            auto stop_iterator = std::lower_bound(start_iterator, selections[index]->end(), (offsets[index])[pos] + (sizes[index])[pos]);
+            auto start_iterator = std::lower_bound(starts[index], selections[index]->end(), offset);
+            auto stop_iterator = std::lower_bound(start_iterator, selections[index]->end(), offset + size);
             starts[index] = stop_iterator;
             soa::SelectionVector slicedSelection{start_iterator, stop_iterator};
             std::transform(slicedSelection.begin(), slicedSelection.end(), slicedSelection.begin(),
                            [&](int64_t idx) {
-                             return idx - static_cast<int64_t>((offsets[index])[pos]);
+                             return idx - static_cast<int64_t>(offset);
                            });
 
-            std::decay_t<A1> typedTable{{groupedElementsTable}, std::move(slicedSelection), (offsets[index])[pos]};
+            std::decay_t<A1> typedTable{{groupedElementsTable}, std::move(slicedSelection), offset};
             typedTable.bindInternalIndicesTo(&std::get<A1>(*mAt));
             return typedTable;
           } else {
-            auto groupedElementsTable = arrow::util::get<std::shared_ptr<arrow::Table>>(((groups[index])[pos]).value);
-            std::decay_t<A1> typedTable{{groupedElementsTable}, (offsets[index])[pos]};
+            std::decay_t<A1> typedTable{{groupedElementsTable}, offset};
             typedTable.bindInternalIndicesTo(&std::get<A1>(*mAt));
             return typedTable;
           }
@@ -434,9 +497,8 @@ struct AnalysisDataProcessorBuilder {
       typename grouping_t::iterator mGroupingElement;
       uint64_t position = 0;
       soa::SelectionVector const* groupSelection = nullptr;
-      std::array<std::vector<arrow::Datum>, sizeof...(A)> groups;
-      std::array<std::vector<uint64_t>, sizeof...(A)> offsets;
-      std::array<std::vector<int>, sizeof...(A)> sizes;
+      std::array<std::shared_ptr<arrow::Table>, sizeof...(A)> tables;
+      std::array<ArrowTableSlicingCache::SliceInfo const*, sizeof...(A)> slices;
       std::array<soa::SelectionVector const*, sizeof...(A)> selections;
       std::array<soa::SelectionVector::const_iterator, sizeof...(A)> starts;
     };
@@ -451,37 +513,148 @@ struct AnalysisDataProcessorBuilder {
       return GroupSlicerSentinel{max};
     }
     int64_t max;
+    ArrowTableSlicingCache mOwnCache; // used when no external cache is provided
     GroupSlicerIterator mBegin;
   };
 
   template <typename Task, typename... T>
-  static void invokeProcessTuple(Task& task, InputRecord& inputs, std::tuple<T...> const& processTuple, std::vector<ExpressionInfo> const& infos)
+  static void invokeProcessTuple(Task& task, InputRecord& inputs, std::tuple<T...> const& processTuple, std::vector<ExpressionInfo> const& infos, ArrowTableSlicingCache& cache, ThreadCopies<Task> const& copies = {})
   {
-    (invokeProcess<o2::framework::has_type_at_v<T>(pack<T...>{})>(task, inputs, std::get<T>(processTuple), infos), ...);
+    (invokeProcess<o2::framework::has_type_at_v<T>(pack<T...>{})>(task, inputs, std::get<T>(processTuple), infos, cache, copies), ...);
   }
 
-  template <typename Task, typename R, typename C, typename Grouping, typename... Associated>
-  static void invokeProcess(Task& task, InputRecord& inputs, R (C::*processingFunction)(Grouping, Associated...), std::vector<ExpressionInfo> const& infos)
+  /// Bind the partitions of the task to the grouping table
+  template <typename Task, typename G>
+  static void setPartitions(Task& task, G& groupingTable)
   {
-    using G = std::decay_t<Grouping>;
-    auto groupingTable = AnalysisDataProcessorBuilder::bindGroupingTable(inputs, processingFunction, infos);
-
-    // set filtered tables for partitions with grouping
     homogeneous_apply_refs([&groupingTable](auto& x) {
       PartitionManager<std::decay_t<decltype(x)>>::setPartition(x, groupingTable);
       PartitionManager<std::decay_t<decltype(x)>>::bindInternalIndices(x, &groupingTable);
       return true;
     },
                            task);
+  }
+
+  /// Bind (a slice of) an associated table to the other tables and to the partitions of the task
+  template <typename Task, typename G, typename X, typename... A>
+  static void bindAssociated(Task& task, G& groupingTable, std::tuple<A...>& associatedTables, X& x)
+  {
+    x.bindExternalIndices(&groupingTable, &std::get<A>(associatedTables)...);
+    homogeneous_apply_refs([&x](auto& t) {
+      PartitionManager<std::decay_t<decltype(t)>>::setPartition(t, x);
+      PartitionManager<std::decay_t<decltype(t)>>::bindExternalIndices(t, &x);
+      PartitionManager<std::decay_t<decltype(t)>>::getBoundToExternalIndices(t, x);
+      return true;
+    },
+                           task);
+  }
+
+  /// Bind the full tables to each other and to the partitions of the task
+  template <typename Task, typename G, typename... A>
+  static void bindFullTables(Task& task, G& groupingTable, std::tuple<A...>& associatedTables)
+  {
+    //pre-bind self indices
+    std::apply(
+      [&](auto&... t) {
+        (homogeneous_apply_refs(
+           [&](auto& p) {
+             PartitionManager<std::decay_t<decltype(p)>>::bindInternalIndices(p, &t);
+             return true;
+           },
+           task),
+         ...);
+      },
+      associatedTables);
+
+    groupingTable.bindExternalIndices(&std::get<A>(associatedTables)...);
+
+    // always pre-bind full tables to support index hierarchy
+    std::apply(
+      [&](auto&&... x) {
+        (bindAssociated(task, groupingTable, associatedTables, x), ...);
+      },
+      associatedTables);
+  }
+
+  /// Bind the partitions of the task to the grouping table and to its external indices
+  template <typename Task, typename G>
+  static void bindGroupingPartitions(Task& task, G& groupingTable)
+  {
+    homogeneous_apply_refs([&groupingTable](auto& x) {
+      PartitionManager<std::decay_t<decltype(x)>>::bindExternalIndices(x, &groupingTable);
+      PartitionManager<std::decay_t<decltype(x)>>::getBoundToExternalIndices(x, groupingTable);
+      return true;
+    },
+                           task);
+  }
+
+  /// Invoke the process function on a single group
+  template <typename Task, typename F, typename G, typename S, typename... A>
+  static void processGroup(Task& task, F processingFunction, G& groupingTable, std::tuple<A...>& associatedTables, S& slice)
+  {
+    auto associatedSlices = slice.associatedTables();
+
+    std::apply(
+      [&](auto&&... x) {
+        (bindAssociated(task, groupingTable, associatedTables, x), ...);
+      },
+      associatedSlices);
+
+    // bind partitions and grouping table
+    bindGroupingPartitions(task, groupingTable);
+
+    invokeProcessWithArgsGeneric(task, processingFunction, slice.groupingElement(), associatedSlices);
+  }
+
+  /// Split the groups in contiguous ranges, processed concurrently by the task and by its copies.
+  /// Every copy works on its own copy of the tables, since binding the partitions modifies them.
+  /// The slicing cache is filled upfront, when the slicers are made, and only read in the threads.
+  /// The partitions of each instance are filtered in its thread for each group: every instance
+  /// evaluates its own gandiva filters, whose compilation cache is thread-safe.
+  template <typename Task, typename F, typename G, typename... A>
+  static void processGroupsConcurrently(Task& task, ThreadCopies<Task> const& threadCopies, F processingFunction, G& groupingTable, std::tuple<A...>& associatedTables, ArrowTableSlicingCache& cache)
+  {
+    using slicer_t = decltype(GroupSlicer(groupingTable, associatedTables, cache));
+    auto const& copies = threadCopies.copies;
+    auto nInstances = copies.size() + 1;
+    std::vector<G> groupingTables(nInstances, groupingTable);
+    std::vector<std::tuple<A...>> associatedTablesCopies(nInstances, associatedTables);
+    std::vector<std::unique_ptr<slicer_t>> slicers(nInstances);
+    std::vector<int64_t> firstGroups(nInstances + 1);
+    int64_t nGroups = groupingTable.size();
+    for (auto i = 0u; i < nInstances; ++i) {
+      auto& instance = i == 0 ? task : *copies[i - 1];
+      setPartitions(instance, groupingTables[i]);
+      bindFullTables(instance, groupingTables[i], associatedTablesCopies[i]);
+      slicers[i] = std::make_unique<slicer_t>(groupingTables[i], associatedTablesCopies[i], cache);
+      firstGroups[i] = nGroups * i / nInstances;
+      for (int64_t group = 0; group < firstGroups[i]; ++group) {
+        ++(slicers[i]->begin());
+      }
+    }
+    firstGroups[nInstances] = nGroups;
+
+    threadCopies.pool->run([&](size_t i) {
+      auto& instance = i == 0 ? task : *copies[i - 1];
+      auto& slice = slicers[i]->begin();
+      for (auto group = firstGroups[i]; group < firstGroups[i + 1]; ++group, ++slice) {
+        processGroup(instance, processingFunction, groupingTables[i], associatedTablesCopies[i], slice);
+      }
+    });
+  }
+
+  template <typename Task, typename R, typename C, typename Grouping, typename... Associated>
+  static void invokeProcess(Task& task, InputRecord& inputs, R (C::*processingFunction)(Grouping, Associated...), std::vector<ExpressionInfo> const& infos, ArrowTableSlicingCache& cache, ThreadCopies<Task> const& copies = {})
+  {
+    using G = std::decay_t<Grouping>;
+    auto groupingTable = AnalysisDataProcessorBuilder::bindGroupingTable(inputs, processingFunction, infos);
+
+    // set filtered tables for partitions with grouping
+    setPartitions(task, groupingTable);
 
     if constexpr (sizeof...(Associated) == 0) {
       // single argument to process
-      homogeneous_apply_refs([&groupingTable](auto& x) {
-        PartitionManager<std::decay_t<decltype(x)>>::bindExternalIndices(x, &groupingTable);
-        PartitionManager<std::decay_t<decltype(x)>>::getBoundToExternalIndices(x, groupingTable);
-        return true;
-      },
-                             task);
+      bindGroupingPartitions(task, groupingTable);
       if constexpr (soa::is_soa_iterator_t<G>::value) {
         for (auto& element : groupingTable) {
           std::invoke(processingFunction, task, *element);
@@ -496,70 +669,24 @@ struct AnalysisDataProcessorBuilder {
       static_assert(((soa::is_soa_iterator_t<std::decay_t<Associated>>::value == false) && ...),
                     "Associated arguments of process() should not be iterators");
       auto associatedTables = AnalysisDataProcessorBuilder::bindAssociatedTables(inputs, processingFunction, infos);
-      //pre-bind self indices
-      std::apply(
-        [&](auto&... t) {
-          (homogeneous_apply_refs(
-             [&](auto& p) {
-               PartitionManager<std::decay_t<decltype(p)>>::bindInternalIndices(p, &t);
-               return true;
-             },
-             task),
-           ...);
-        },
-        associatedTables);
-
-      auto binder = [&](auto&& x) {
-        x.bindExternalIndices(&groupingTable, &std::get<std::decay_t<Associated>>(associatedTables)...);
-        homogeneous_apply_refs([&x](auto& t) {
-          PartitionManager<std::decay_t<decltype(t)>>::setPartition(t, x);
-          PartitionManager<std::decay_t<decltype(t)>>::bindExternalIndices(t, &x);
-          PartitionManager<std::decay_t<decltype(t)>>::getBoundToExternalIndices(t, x);
-          return true;
-        },
-                               task);
-      };
-      groupingTable.bindExternalIndices(&std::get<std::decay_t<Associated>>(associatedTables)...);
-
-      // always pre-bind full tables to support index hierarchy
-      std::apply(
-        [&](auto&&... x) {
-          (binder(x), ...);
-        },
-        associatedTables);
 
       if constexpr (soa::is_soa_iterator_t<std::decay_t<G>>::value) {
         // grouping case
-        auto slicer = GroupSlicer(groupingTable, associatedTables);
-        for (auto& slice : slicer) {
-          auto associatedSlices = slice.associatedTables();
-
-          std::apply(
-            [&](auto&&... x) {
-              (binder(x), ...);
-            },
-            associatedSlices);
-
-          // bind partitions and grouping table
-          homogeneous_apply_refs([&groupingTable](auto& x) {
-            PartitionManager<std::decay_t<decltype(x)>>::bindExternalIndices(x, &groupingTable);
-            PartitionManager<std::decay_t<decltype(x)>>::getBoundToExternalIndices(x, groupingTable);
-            return true;
-          },
-                                 task);
-
-          invokeProcessWithArgsGeneric(task, processingFunction, slice.groupingElement(), associatedSlices);
+        if (copies.empty() == false) {
+          processGroupsConcurrently(task, copies, processingFunction, groupingTable, associatedTables, cache);
+        } else {
+          bindFullTables(task, groupingTable, associatedTables);
+          auto slicer = GroupSlicer(groupingTable, associatedTables, cache);
+          for (auto& slice : slicer) {
+            processGroup(task, processingFunction, groupingTable, associatedTables, slice);
+          }
         }
       } else {
         // non-grouping case
+        bindFullTables(task, groupingTable, associatedTables);
 
         // bind partitions and grouping table
-        homogeneous_apply_refs([&groupingTable](auto& x) {
-          PartitionManager<std::decay_t<decltype(x)>>::bindExternalIndices(x, &groupingTable);
-          PartitionManager<std::decay_t<decltype(x)>>::getBoundToExternalIndices(x, groupingTable);
-          return true;
-        },
-                               task);
+        bindGroupingPartitions(task, groupingTable);
 
         invokeProcessWithArgsGeneric(task, processingFunction, groupingTable, associatedTables);
       }
@@ -738,6 +865,8 @@ DataProcessorSpec adaptAnalysisTask(ConfigContext const& ctx, Args&&... args)
   /// make sure options and configurables are set before expression infos are created
   homogeneous_apply_refs([&options, &hash](auto& x) { return OptionManager<std::decay_t<decltype(x)>>::appendOption(options, x); }, *task.get());
 
+  options.push_back(ConfigParamSpec{"process-threads", VariantType::Int, 1, {"number of threads processing the groups of the process functions; tasks producing tables or using services are processed in a single thread"}});
+
   /// parse process functions defined by corresponding configurables
   if constexpr (has_process_v<T>) {
     AnalysisDataProcessorBuilder::inputsFromArgs(&T::process, "default", true, inputs, expressionInfos);
@@ -780,19 +909,13 @@ DataProcessorSpec adaptAnalysisTask(ConfigContext const& ctx, Args&&... args)
   homogeneous_apply_refs([&outputs, &hash](auto& x) { return OutputManager<std::decay_t<decltype(x)>>::appendOutput(outputs, x, hash); }, *task.get());
 
   std::vector<ServiceSpec> requiredServices = CommonServices::defaultServices();
+  requiredServices.push_back(CommonAnalysisServices::arrowTableSlicingCacheSpec());
   homogeneous_apply_refs([&requiredServices](auto& x) { return ServiceManager<std::decay_t<decltype(x)>>::add(requiredServices, x); }, *task.get());
 
   auto algo = AlgorithmSpec::InitCallback{[task = task, expressionInfos](InitContext& ic) mutable {
     homogeneous_apply_refs([&ic](auto&& x) { return OptionManager<std::decay_t<decltype(x)>>::prepare(ic, x); }, *task.get());
     homogeneous_apply_refs([&ic](auto&& x) { return ServiceManager<std::decay_t<decltype(x)>>::prepare(ic, x); }, *task.get());
 
-    auto& callbacks = ic.services().get<CallbackService>();
-    auto endofdatacb = [task](EndOfStreamContext& eosContext) {
-      homogeneous_apply_refs([&eosContext](auto&& x) { return OutputManager<std::decay_t<decltype(x)>>::postRun(eosContext, x); }, *task.get());
-      eosContext.services().get<ControlService>().readyToQuit(QuitRequest::Me);
-    };
-    callbacks.set(CallbackService::Id::EndOfStream, endofdatacb);
-
     /// update configurables in filters
     homogeneous_apply_refs(
       [&ic](auto& x) -> bool { return FilterManager<std::decay_t<decltype(x)>>::updatePlaceholders(x, ic); },
@@ -811,19 +934,37 @@ DataProcessorSpec adaptAnalysisTask(ConfigContext const& ctx, Args&&... args)
       task->init(ic);
     }
 
-    return [task, expressionInfos](ProcessingContext& pc) {
+    /// copies of the initialised task, processing part of the groups in separate threads
+    auto copies = makeThreadCopies(*task.get(), ic.options().get<int>("process-threads"));
+
+    auto& callbacks = ic.services().get<CallbackService>();
+    auto endofdatacb = [task, copies](EndOfStreamContext& eosContext) {
+      for (auto& copy : copies.copies) {
+        applyToThreadCopy([](auto& x, auto& y) { return OutputManager<std::decay_t<decltype(x)>>::mergeThreadCopy(x, y); }, *task.get(), *copy.get());
+      }
+      homogeneous_apply_refs([&eosContext](auto&& x) { return OutputManager<std::decay_t<decltype(x)>>::postRun(eosContext, x); }, *task.get());
+      eosContext.services().get<ControlService>().readyToQuit(QuitRequest::Me);
+    };
+    callbacks.set(CallbackService::Id::EndOfStream, endofdatacb);
+
+    return [task, expressionInfos, copies](ProcessingContext& pc) {
       homogeneous_apply_refs([&pc](auto&& x) { return OutputManager<std::decay_t<decltype(x)>>::prepare(pc, x); }, *task.get());
+      for (auto& copy : copies.copies) {
+        applyToThreadCopy([](auto& x, auto& y) { return OutputManager<std::decay_t<decltype(x)>>::prepareThreadCopy(x, y); }, *task.get(), *copy.get());
+      }
       if constexpr (has_run_v<T>) {
         task->run(pc);
       }
+      // the slicing of the tables is shared by all the process functions and cleared at the end of the timeframe
+      auto& slicingCache = pc.services().get<ArrowTableSlicingCache>();
       if constexpr (has_process_v<T>) {
-        AnalysisDataProcessorBuilder::invokeProcess(*(task.get()), pc.inputs(), &T::process, expressionInfos);
+        AnalysisDataProcessorBuilder::invokeProcess(*(task.get()), pc.inputs(), &T::process, expressionInfos, slicingCache, copies);
       }
       homogeneous_apply_refs(
-        [&pc, &expressionInfos, &task](auto& x) {
+        [&pc, &expressionInfos, &task, &slicingCache, &copies](auto& x) {
           if constexpr (is_base_of_template<ProcessConfigurable, std::decay_t<decltype(x)>>::value) {
             if (x.value == true) {
-              AnalysisDataProcessorBuilder::invokeProcess(*task.get(), pc.inputs(), x.process, expressionInfos);
+              AnalysisDataProcessorBuilder::invokeProcess(*task.get(), pc.inputs(), x.process, expressionInfos, slicingCache, copies);
               return true;
             }
           }
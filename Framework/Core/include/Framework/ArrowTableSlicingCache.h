@@ -0,0 +1,83 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_FRAMEWORK_ARROWTABLESLICINGCACHE_H_
+#define O2_FRAMEWORK_ARROWTABLESLICINGCACHE_H_
+
+#include "Framework/Kernels.h"
+#include "Framework/RuntimeError.h"
+
+#include <arrow/table.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// Cache of the groups in which the tables are sliced by their index columns.
+/// An index column is identified by its name and by the memory holding its
+/// values, so that all the process() functions grouping the same table
+/// by the same index share the result, even if the table itself is
+/// rebuilt from the inputs (or joined to others) for each of them.
+/// The cache is meant to live for one timeframe only: it has to be cleared
+/// before the memory of the inputs is released.
+struct ArrowTableSlicingCache {
+  /// offsets and sizes of the groups, the slices themselves are
+  /// made by the user of the cache from its own table
+  struct SliceInfo {
+    std::vector<uint64_t> offsets;
+    std::vector<int> sizes;
+  };
+
+  /// Return the groups of the @a input table sliced by the index column @a key
+  /// into @a fullSize groups, computing them if they are not cached yet.
+  SliceInfo const& getSlices(std::string const& key, std::shared_ptr<arrow::Table> const& input, int32_t fullSize)
+  {
+    auto column = input->GetColumnByName(key);
+    if (column == nullptr || column->num_chunks() == 0) {
+      throw runtime_error_f("Cannot split collection: no column %s", key.c_str());
+    }
+    auto const& data = column->chunk(0)->data();
+    auto [entry, isNew] = mSlices.try_emplace(Key{key, data->buffers[1]->data(), data->offset, column->length(), fullSize});
+    if (isNew) {
+      auto result = o2::framework::sliceByColumn(key.c_str(), input, fullSize, nullptr, &entry->second.offsets, &entry->second.sizes);
+      if (result.ok() == false) {
+        mSlices.erase(entry);
+        throw runtime_error("Cannot split collection");
+      }
+    }
+    return entry->second;
+  }
+
+  /// Drop all the cached groups, to be called at the end of each timeframe.
+  void clear()
+  {
+    mSlices.clear();
+  }
+
+  size_t size() const
+  {
+    return mSlices.size();
+  }
+
+ private:
+  using Key = std::tuple<std::string, uint8_t const*, int64_t, int64_t, int32_t>;
+  std::map<Key, SliceInfo> mSlices;
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_ARROWTABLESLICINGCACHE_H_
@@ -73,6 +73,7 @@ struct CommonServices {
 
 struct CommonAnalysisServices {
   static ServiceSpec databasePDGSpec();
+  static ServiceSpec arrowTableSlicingCacheSpec();
 
   template <typename T>
   static void addAnalysisService(std::vector<ServiceSpec>& specs)
@@ -164,6 +164,16 @@ struct Node {
   {
   }
 
+  /// deep copy of the tree
+  Node(Node const& n)
+    : self{n.self},
+      index{n.index},
+      left{n.left ? std::make_unique<Node>(*n.left) : nullptr},
+      right{n.right ? std::make_unique<Node>(*n.right) : nullptr},
+      condition{n.condition ? std::make_unique<Node>(*n.condition) : nullptr}
+  {
+  }
+
   Node(BindingNode n) : self{n}, left{nullptr}, right{nullptr}, condition{nullptr}
   {
   }
@@ -399,6 +409,11 @@ struct Filter {
   {
     (void)designateSubtrees(node.get());
   }
+
+  Filter(Filter const& other) : node{std::make_unique<Node>(*other.node)}
+  {
+    (void)designateSubtrees(node.get());
+  }
   std::unique_ptr<Node> node;
 
   size_t designateSubtrees(Node* node, size_t index = 0);
@@ -26,6 +26,7 @@
 #include <TDataMember.h>
 #include <TDataType.h>
 
+#include <array>
 #include <deque>
 
 class TList;
@@ -34,6 +35,70 @@ class TList;
 
 namespace o2::framework
 {
+//**************************************************************************************************
+/**
+ * Helper class to fill TH1, TH2 and TH3 with whole columns of values. The bin indices are computed for blocks of rows
+ * in loops without dependencies between the rows, which the compiler can vectorise, and the contents are summed in a
+ * local buffer which is added to the histogram in one pass, instead of calling the virtual Fill() for each row.
+ */
+//**************************************************************************************************
+class ColumnHistFiller
+{
+ public:
+  static constexpr size_t BLOCK_SIZE{1024};
+
+  ColumnHistFiller(TH1* hist, int nDimensions, bool hasWeight, size_t nRows);
+
+  // check if the histogram can be filled by columns (profiles, buffered histograms and extendable axes are not supported)
+  static bool isSupported(TH1* hist, int nDimensions);
+
+  // add one row: the positions along each axis, followed by the weight if requested
+  template <typename... Ts>
+  void add(Ts... positionAndWeight)
+  {
+    size_t i = 0;
+    ((mValues[i++][mNRows] = static_cast<double>(positionAndWeight)), ...);
+    if (++mNRows == BLOCK_SIZE) {
+      flushBlock();
+    }
+  }
+
+  // add the accumulated contents and statistics to the histogram
+  void finalize();
+
+ private:
+  // binning of one axis
+  struct Axis {
+    int nBins{};
+    double min{};
+    double max{};
+    const double* edges{nullptr}; // only for variable binning
+  };
+
+  // compute the bins of the rows of the current block and accumulate them
+  void flushBlock();
+
+  // compute the bins along one axis, as TAxis::FindBin() does
+  static void findBins(const Axis& axis, const double* values, int* bins, size_t n);
+
+  TH1* mHist;
+  int mNDimensions;
+  bool mHasWeight;
+  bool mDense;                   // accumulate in a buffer covering all the cells of the histogram
+  bool mStatOverflows;           // under- and overflows are included in the statistics
+  bool mHasNonUnitWeight{false}; // sum of weights squared is required
+  std::array<Axis, 3> mAxes{};
+  std::array<int, 3> mStrides{}; // distance between consecutive bins along each axis
+  size_t mNRows{0};              // rows in the current block
+  double mNEntries{0.};          // rows added in total
+  std::array<std::vector<double>, 4> mValues;
+  std::array<std::vector<int>, 3> mAxisBins;
+  std::vector<int> mBins;
+  std::vector<double> mContent; // dense buffer of the contents
+  std::vector<double> mSumw2;   // dense buffer of the sum of the squared weights
+  std::array<double, TH1::kNstat> mStats{};
+};
+
 //**************************************************************************************************
 /**
  * Static helper class to fill root histograms of any type. Contains functionality to fill once per call or a whole (filtered) table at once.
@@ -132,6 +197,12 @@ class HistogramRegistry
   // print summary of the histograms stored in registry
   void print(bool showAxisDetails = false);
 
+  // replace the histograms by empty clones, so that a copy of the registry can be filled independently
+  void detachHistograms();
+
+  // add the content of the histograms of a (detached) copy of this registry
+  void merge(HistogramRegistry& other);
+
   // lookup distance counter for benchmarking
   mutable uint32_t lookup = 0;
 
@@ -224,11 +295,24 @@ void HistFiller::fillHistAny(std::shared_ptr<T>& hist, const Ts&... positionAndW
 template <typename... Cs, typename R, typename T>
 void HistFiller::fillHistAny(std::shared_ptr<R>& hist, const T& table, const o2::framework::expressions::Filter& filter)
 {
-  if constexpr (std::is_base_of_v<StepTHn, T>) {
+  if constexpr (std::is_base_of_v<StepTHn, R>) {
     LOGF(FATAL, "Table filling is not (yet?) supported for StepTHn.");
     return;
   }
   auto filtered = o2::soa::Filtered<T>{{table.asArrowTable()}, o2::framework::expressions::createSelection(table.asArrowTable(), filter)};
+
+  constexpr int nDimensions = std::is_same_v<TH1, R> ? 1 : (std::is_same_v<TH2, R> ? 2 : (std::is_same_v<TH3, R> ? 3 : 0));
+  if constexpr (nDimensions > 0 && (sizeof...(Cs) == nDimensions || sizeof...(Cs) == nDimensions + 1) && (std::is_arithmetic_v<typename Cs::type> && ...)) {
+    if (ColumnHistFiller::isSupported(hist.get(), nDimensions)) {
+      ColumnHistFiller filler(hist.get(), nDimensions, sizeof...(Cs) == nDimensions + 1, filtered.size());
+      for (auto& t : filtered) {
+        filler.add((*(static_cast<Cs>(t).getIterator()))...);
+      }
+      filler.finalize();
+      return;
+    }
+  }
+
   for (auto& t : filtered) {
     fillHistAny(hist, (*(static_cast<Cs>(t).getIterator()))...);
   }
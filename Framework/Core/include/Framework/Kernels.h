@@ -27,7 +27,7 @@ namespace o2::framework
 {
 /// Slice a given table in a vector of tables each containing a slice.
 /// @a slices the arrow tables in which the original @a input
-/// is split into.
+/// is split into, can be nullptr if only the offsets and sizes are needed.
 /// @a offset the offset in the original table at which the corresponding
 /// slice was split.
 template <typename T>
@@ -59,8 +59,12 @@ auto sliceByColumn(
   auto count = 0;
   auto size = values.length();
 
+  auto nslices = 0;
   auto makeSlice = [&](uint64_t offset_, T count_) {
-    slices->emplace_back(arrow::Datum{input->Slice(offset_, count_)});
+    ++nslices;
+    if (slices) {
+      slices->emplace_back(arrow::Datum{input->Slice(offset_, count_)});
+    }
     if (offsets) {
       offsets->emplace_back(offset_);
     }
@@ -93,7 +97,7 @@ auto sliceByColumn(
       offset += count;
       continue;
     }
-    nzeros = v - vprev - ((i == 0 || slices->empty() == true) ? 0 : 1);
+    nzeros = v - vprev - ((i == 0 || nslices == 0) ? 0 : 1);
     for (auto z = 0; z < nzeros; ++z) {
       makeSlice(offset, 0);
     }
@@ -0,0 +1,62 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_FRAMEWORK_PROCESSTHREADPOOL_H_
+#define O2_FRAMEWORK_PROCESSTHREADPOOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace o2::framework
+{
+
+/// Threads in which the copies of an analysis task process their part of
+/// the groups. They are started once, together with the copies, and wait
+/// for work between the process functions and the timeframes.
+class ProcessThreadPool
+{
+ public:
+  explicit ProcessThreadPool(size_t nWorkers);
+  ~ProcessThreadPool();
+
+  ProcessThreadPool(ProcessThreadPool const&) = delete;
+  ProcessThreadPool& operator=(ProcessThreadPool const&) = delete;
+
+  size_t workers() const { return mThreads.size(); }
+
+  /// Call @a job with 0 in the calling thread and with 1 to workers()
+  /// in the workers, and return once all the calls are done. The first
+  /// exception thrown by any of them, in order of their argument, is rethrown.
+  void run(std::function<void(size_t)> const& job);
+
+ private:
+  void work(size_t index);
+
+  std::vector<std::thread> mThreads;
+  std::mutex mMutex;
+  std::condition_variable mStart;
+  std::condition_variable mDone;
+  std::function<void(size_t)> const* mJob = nullptr;
+  std::vector<std::exception_ptr> mErrors;
+  uint64_t mGeneration = 0;
+  size_t mPending = 0;
+  bool mStop = false;
+};
+
+} // namespace o2::framework
+
+#endif // O2_FRAMEWORK_PROCESSTHREADPOOL_H_
@@ -54,23 +54,17 @@ class BranchIterator
 
   TBranch* mBranchPtr = nullptr;
 
+  // the branch address points to the current row in the values buffer of the current chunk,
+  // except for bool, which is unpacked to mBranchBuffer
   char* mBranchBuffer = nullptr;
-  void* mValueBuffer = nullptr;
-
-  std::shared_ptr<arrow::BooleanArray> mArray_o = nullptr;
-  //bool mBoolValueHolder;
-  bool* mVariable_o = nullptr;
-
-  uint8_t* mVariable_ub = nullptr;
-  uint16_t* mVariable_us = nullptr;
-  uint32_t* mVariable_ui = nullptr;
-  uint64_t* mVariable_ul = nullptr;
-  int8_t* mVariable_b = nullptr;
-  int16_t* mVariable_s = nullptr;
-  int32_t* mVariable_i = nullptr;
-  int64_t* mVariable_l = nullptr;
-  float* mVariable_f = nullptr;
-  double* mVariable_d = nullptr;
+  int32_t mRowSize = 0;              // size of a row in bytes
+  const char* mCurrentRow = nullptr; // current row in the values buffer of the current chunk
+
+  std::shared_ptr<arrow::BooleanArray> mArray_o = nullptr; // bool is bit-packed in arrow, needs unpacking
+  int64_t mFirstElement_o = 0;                             // first element of the current chunk in mArray_o
+
+  // point the branch to the current row
+  void setRow();
 
   // initialize a branch
   bool initBranch(TTree* tree);
@@ -111,6 +105,10 @@ class TableToTree
   bool addBranch(std::shared_ptr<arrow::ChunkedArray> col, std::shared_ptr<arrow::Field> field);
   bool addAllBranches();
 
+  // maximum basket size of the created branches: the baskets are sized to hold all rows of the
+  // table (up to this limit), so that they are compressed in one go, in parallel if ROOT implicit MT is enabled
+  static constexpr int MaxBasketSize = 4 * 1024 * 1024;
+
   // write table to tree
   TTree* process();
 };
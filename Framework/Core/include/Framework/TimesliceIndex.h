@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 namespace o2::framework
@@ -73,6 +74,9 @@ class TimesliceIndex
   inline bool isValid(TimesliceSlot const& slot) const;
   inline bool isDirty(TimesliceSlot const& slot) const;
   inline void markAsDirty(TimesliceSlot slot, bool value);
+  /// @return true if at least one slot is dirty, so that the completion
+  /// policies need to be evaluated.
+  inline bool hasDirtySlots() const;
   inline void markAsInvalid(TimesliceSlot slot);
   /// Publish a slot to be sent via metrics.
   inline void publishSlot(TimesliceSlot slot);
@@ -91,6 +95,10 @@ class TimesliceIndex
   /// VariableContext.
   inline data_matcher::VariableContext& getPublishedVariablesForSlot(TimesliceSlot slot);
 
+  /// Find the slot currently associated to the given @a timeslice in O(1).
+  /// @return an invalid slot if no slot holds the timeslice.
+  inline TimesliceSlot findSlotForTimeslice(TimesliceId timeslice) const;
+
   /// Find the LRU entry in the cache and replace it with @a newContext
   /// @a slot is filled with the slot used to hold the context, if applicable.
   /// @a timestamp must be provided to select the correct lane, in case of pipelining
@@ -103,6 +111,10 @@ class TimesliceIndex
   /// This is the timeslices for all the in flight parts.
   inline TimesliceSlot findOldestSlot(TimesliceId) const;
 
+  /// Add / remove the timeslice of the slot to / from the timeslice -> slot map.
+  inline void indexSlot(TimesliceSlot slot);
+  inline void unindexSlot(TimesliceSlot slot);
+
   /// The variables for each cacheline.
   std::vector<data_matcher::VariableContext> mVariables;
 
@@ -112,6 +124,13 @@ class TimesliceIndex
   /// This keeps track whether or not something was relayed
   /// since last time we called getReadyToProcess()
   std::vector<bool> mDirty;
+  /// How many slots are dirty
+  size_t mDirtyCount = 0;
+
+  /// Map from the timeslice to the slot holding it. It is updated whenever
+  /// the timeslice of a slot changes and when a slot is published, so that the
+  /// relayer does not need to scan all the slots to find the one to use.
+  std::unordered_map<uint64_t, size_t> mSlotsByTimeslice;
 
   /// What to do in case of backpressure
   BackpressureOp mBackpressurePolicy = BackpressureOp::Wait;
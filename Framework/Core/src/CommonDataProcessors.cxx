@@ -37,6 +37,7 @@
 
 #include "TFile.h"
 #include "TTree.h"
+#include "TROOT.h"
 
 #include <ROOT/RSnapshotOptions.hxx>
 #include <ROOT/RDataFrame.hxx>
@@ -276,6 +277,13 @@ DataProcessorSpec
       };
     }
 
+    // the baskets of the output trees are compressed in parallel by ROOT implicit MT
+    auto nThreads = ic.options().get<int>("aod-writer-nthreads");
+    if (nThreads > 1) {
+      ROOT::EnableImplicitMT(nThreads);
+      LOGP(INFO, "Compressing AOD baskets with {} threads", nThreads);
+    }
+
     // end of data functor is called at the end of the data stream
     auto endofdatacb = [dod](EndOfStreamContext& context) {
       dod->closeDataFiles();
@@ -389,7 +397,7 @@ DataProcessorSpec
     outputInputs,
     Outputs{},
     AlgorithmSpec(writerFunction),
-    {}};
+    {{"aod-writer-nthreads", VariantType::Int, 1, {"Number of threads for the compression of the AOD baskets"}}}};
 
   return spec;
 }
@@ -34,6 +34,7 @@
 #include "HTTPParser.h"
 #include "../src/DataProcessingStatus.h"
 #include "ArrowSupport.h"
+#include "Framework/ArrowTableSlicingCache.h"
 #include "DPLMonitoringBackend.h"
 #include "TDatabasePDG.h"
 
@@ -555,5 +556,16 @@ o2::framework::ServiceSpec CommonAnalysisServices::databasePDGSpec()
     .exit = [](ServiceRegistry&, void* service) { reinterpret_cast<TDatabasePDG*>(service)->Delete(); },
     .kind = ServiceKind::Serial};
 }
+
+o2::framework::ServiceSpec CommonAnalysisServices::arrowTableSlicingCacheSpec()
+{
+  return ServiceSpec{
+    .name = "arrow-slicing-cache",
+    .init = CommonServices::simpleServiceInit<ArrowTableSlicingCache, ArrowTableSlicingCache>(),
+    .configure = CommonServices::noConfiguration(),
+    // the cached groups refer to the memory of the inputs of the timeframe
+    .postProcessing = [](ProcessingContext&, void* service) { reinterpret_cast<ArrowTableSlicingCache*>(service)->clear(); },
+    .kind = ServiceKind::Serial};
+}
 } // namespace o2::framework
 #pragma GCC diagnostic pop
@@ -337,9 +337,17 @@ DataRelayer::RelayChoice
   auto slot = TimesliceSlot{TimesliceSlot::INVALID};
 
   bool needsCleaning = false;
-  // First look for matching slots which already have some
+  // Fast path: the timeslice is always bound to the start time of the data,
+  // so we can ask the index for the slot which already holds it and match
+  // only against that one.
+  slot = index.findSlotForTimeslice(TimesliceId{dph->startTime});
+  if (TimesliceSlot::isValid(slot) && isSlotInLane(slot)) {
+    std::tie(input, timeslice) = getInputTimeslice(index.getVariablesForSlot(slot));
+  }
+
+  // If that did not work, look for matching slots which already have some
   // partial match.
-  for (size_t ci = 0; ci < index.size(); ++ci) {
+  for (size_t ci = 0; input == INVALID_INPUT && ci < index.size(); ++ci) {
     slot = TimesliceSlot{ci};
     if (!isSlotInLane(slot)) {
       continue;
@@ -507,6 +515,10 @@ void DataRelayer::getReadyToProcess(std::vector<DataRelayer::RecordAction>& comp
   if (numInputTypes == 0) {
     return;
   }
+  // Nothing changed since the last time we checked.
+  if (mTimesliceIndex.hasDirtySlots() == false) {
+    return;
+  }
   size_t cacheLines = cache.size() / numInputTypes;
   assert(cacheLines * numInputTypes == cache.size());
 
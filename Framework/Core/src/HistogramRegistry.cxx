@@ -10,12 +10,180 @@
 // or submit itself to any jurisdiction.
 
 #include "Framework/HistogramRegistry.h"
+#include <algorithm>
 #include <regex>
 #include <TList.h>
 
 namespace o2::framework
 {
 
+ColumnHistFiller::ColumnHistFiller(TH1* hist, int nDimensions, bool hasWeight, size_t nRows)
+  : mHist{hist},
+    mNDimensions{nDimensions},
+    mHasWeight{hasWeight},
+    mStatOverflows{hist->GetStatOverflowsBehaviour()}
+{
+  TAxis* axes[3] = {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()};
+  int stride = 1;
+  for (int d = 0; d < mNDimensions; ++d) {
+    mAxes[d] = {axes[d]->GetNbins(), axes[d]->GetXmin(), axes[d]->GetXmax(), axes[d]->GetXbins()->fN ? axes[d]->GetXbins()->GetArray() : nullptr};
+    mStrides[d] = stride;
+    stride *= mAxes[d].nBins + 2;
+    mAxisBins[d].resize(BLOCK_SIZE);
+  }
+  for (int i = 0; i < mNDimensions + mHasWeight; ++i) {
+    mValues[i].resize(BLOCK_SIZE);
+  }
+  mBins.resize(BLOCK_SIZE);
+
+  // a buffer covering all the cells only pays off if they are not many more than the rows
+  mDense = hist->GetNcells() <= 4 * std::max(nRows, BLOCK_SIZE);
+  if (mDense) {
+    mContent.resize(hist->GetNcells());
+    mSumw2.resize(hist->GetNcells());
+  }
+  // the statistics are updated at the end, but must be taken before any bin content changes
+  hist->GetStats(mStats.data());
+  mNEntries = hist->GetEntries();
+}
+
+bool ColumnHistFiller::isSupported(TH1* hist, int nDimensions)
+{
+  if (hist->InheritsFrom(TProfile::Class()) || hist->InheritsFrom(TProfile2D::Class()) || hist->InheritsFrom(TProfile3D::Class())) {
+    return false;
+  }
+  if (hist->GetBuffer() != nullptr || hist->GetDimension() != nDimensions) {
+    return false;
+  }
+  TAxis* axes[3] = {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()};
+  for (int d = 0; d < nDimensions; ++d) {
+    if (axes[d]->CanExtend()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ColumnHistFiller::findBins(const Axis& axis, const double* values, int* bins, size_t n)
+{
+  if (axis.edges == nullptr) {
+    // same expression as in TAxis::FindBin(), so that the values on the bin edges end up in the same bins
+    const double nBins = axis.nBins;
+    const double width = axis.max - axis.min;
+    for (size_t i = 0; i < n; ++i) {
+      double x = values[i];
+      double bin = nBins * (x - axis.min) / width;
+      bin = (x < axis.min) ? -1. : bin;
+      bin = !(x < axis.max) ? nBins : bin;
+      bins[i] = 1 + static_cast<int>(bin);
+    }
+  } else {
+    const double* end = axis.edges + axis.nBins + 1;
+    for (size_t i = 0; i < n; ++i) {
+      double x = values[i];
+      if (x < axis.min) {
+        bins[i] = 0;
+      } else if (!(x < axis.max)) {
+        bins[i] = axis.nBins + 1;
+      } else {
+        bins[i] = std::upper_bound(axis.edges, end, x) - axis.edges;
+      }
+    }
+  }
+}
+
+void ColumnHistFiller::flushBlock()
+{
+  if (mNRows == 0) {
+    return;
+  }
+  std::fill(mBins.begin(), mBins.begin() + mNRows, 0);
+  for (int d = 0; d < mNDimensions; ++d) {
+    findBins(mAxes[d], mValues[d].data(), mAxisBins[d].data(), mNRows);
+    const int* axisBins = mAxisBins[d].data();
+    const int stride = mStrides[d];
+    for (size_t i = 0; i < mNRows; ++i) {
+      mBins[i] += stride * axisBins[i];
+    }
+  }
+
+  const double* weights = mHasWeight ? mValues[mNDimensions].data() : nullptr;
+  if (weights && !mHasNonUnitWeight) {
+    mHasNonUnitWeight = std::any_of(weights, weights + mNRows, [](double w) { return w != 1.; });
+  }
+
+  // without the dense buffer the block goes directly to the histogram, whose errors
+  // must then be switched to the sum of weights squared as soon as TH1::Fill() would do it
+  if (!mDense && mHasNonUnitWeight && mHist->GetSumw2N() == 0) {
+    mHist->Sumw2();
+  }
+  double* histSumw2 = mHist->GetSumw2N() ? mHist->GetSumw2()->GetArray() : nullptr;
+
+  const double* x = mValues[0].data();
+  const double* y = mValues[1].data();
+  const double* z = mValues[2].data();
+  for (size_t i = 0; i < mNRows; ++i) {
+    const double w = weights ? weights[i] : 1.;
+    const int bin = mBins[i];
+    if (mDense) {
+      mContent[bin] += w;
+      mSumw2[bin] += w * w;
+    } else {
+      mHist->AddBinContent(bin, w);
+      if (histSumw2) {
+        histSumw2[bin] += w * w;
+      }
+    }
+
+    // same statistics as TH1::Fill(), TH2::Fill() and TH3::Fill()
+    bool inRange = true;
+    for (int d = 0; d < mNDimensions; ++d) {
+      inRange &= (mAxisBins[d][i] > 0 && mAxisBins[d][i] <= mAxes[d].nBins);
+    }
+    if (!inRange && !mStatOverflows) {
+      continue;
+    }
+    mStats[0] += w;
+    mStats[1] += w * w;
+    mStats[2] += w * x[i];
+    mStats[3] += w * x[i] * x[i];
+    if (mNDimensions > 1) {
+      mStats[4] += w * y[i];
+      mStats[5] += w * y[i] * y[i];
+      mStats[6] += w * x[i] * y[i];
+    }
+    if (mNDimensions > 2) {
+      mStats[7] += w * z[i];
+      mStats[8] += w * z[i] * z[i];
+      mStats[9] += w * x[i] * z[i];
+      mStats[10] += w * y[i] * z[i];
+    }
+  }
+  mNEntries += mNRows;
+  mNRows = 0;
+}
+
+void ColumnHistFiller::finalize()
+{
+  flushBlock();
+  if (mDense) {
+    if (mHasNonUnitWeight && mHist->GetSumw2N() == 0) {
+      mHist->Sumw2();
+    }
+    double* histSumw2 = mHist->GetSumw2N() ? mHist->GetSumw2()->GetArray() : nullptr;
+    for (int bin = 0; bin < static_cast<int>(mContent.size()); ++bin) {
+      if (mContent[bin] != 0. || mSumw2[bin] != 0.) {
+        mHist->AddBinContent(bin, mContent[bin]);
+        if (histSumw2) {
+          histSumw2[bin] += mSumw2[bin];
+        }
+      }
+    }
+  }
+  mHist->PutStats(mStats.data());
+  mHist->SetEntries(mNEntries);
+}
+
 constexpr HistogramRegistry::HistName::HistName(char const* const name)
   : str(name),
     hash(compile_time_hash(name)),
@@ -263,6 +431,43 @@ void HistogramRegistry::print(bool showAxisDetails)
   LOGF(INFO, "");
 }
 
+// give this registry its own, empty, copy of every histogram
+void HistogramRegistry::detachHistograms()
+{
+  for (auto& histVariant : mRegistryValue) {
+    std::visit([](auto& sharedPtr) {
+      using T = typename std::decay_t<decltype(sharedPtr)>::element_type;
+      if (!sharedPtr) {
+        return;
+      }
+      sharedPtr = std::shared_ptr<T>(static_cast<T*>(sharedPtr->Clone()));
+      // StepTHn cannot be reset, it is expected to be still empty when the registry is detached
+      if constexpr (!std::is_same_v<T, StepTHn>) {
+        sharedPtr->Reset();
+      }
+    },
+               histVariant);
+  }
+}
+
+// the registries have the same layout, since one was copied from the other
+void HistogramRegistry::merge(HistogramRegistry& other)
+{
+  for (auto i = 0u; i < MAX_REGISTRY_SIZE; ++i) {
+    std::visit([&](auto& sharedPtr) {
+      using T = typename std::decay_t<decltype(sharedPtr)>::element_type;
+      auto otherPtr = std::get_if<std::shared_ptr<T>>(&other.mRegistryValue[i]);
+      if (!sharedPtr || !otherPtr || !*otherPtr || sharedPtr == *otherPtr) {
+        return;
+      }
+      TList list;
+      list.Add(otherPtr->get());
+      sharedPtr->Merge(&list);
+    },
+               mRegistryValue[i]);
+  }
+}
+
 // create output structure will be propagated to file-sink
 TList* HistogramRegistry::operator*()
 {
@@ -0,0 +1,96 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#include "Framework/ProcessThreadPool.h"
+
+#include <algorithm>
+
+namespace o2::framework
+{
+
+ProcessThreadPool::ProcessThreadPool(size_t nWorkers)
+  : mErrors(nWorkers + 1)
+{
+  for (size_t i = 1; i <= nWorkers; ++i) {
+    mThreads.emplace_back(&ProcessThreadPool::work, this, i);
+  }
+}
+
+ProcessThreadPool::~ProcessThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStop = true;
+  }
+  mStart.notify_all();
+  for (auto& thread : mThreads) {
+    thread.join();
+  }
+}
+
+void ProcessThreadPool::run(std::function<void(size_t)> const& job)
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mJob = &job;
+    mPending = mThreads.size();
+    ++mGeneration;
+  }
+  mStart.notify_all();
+
+  try {
+    job(0);
+  } catch (...) {
+    mErrors[0] = std::current_exception();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [this] { return mPending == 0; });
+    mJob = nullptr;
+  }
+  for (auto& error : mErrors) {
+    if (error) {
+      auto first = error;
+      std::fill(mErrors.begin(), mErrors.end(), nullptr);
+      std::rethrow_exception(first);
+    }
+  }
+}
+
+void ProcessThreadPool::work(size_t index)
+{
+  uint64_t done = 0;
+  while (true) {
+    std::function<void(size_t)> const* job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mStart.wait(lock, [this, done] { return mStop || mGeneration != done; });
+      if (mStop) {
+        return;
+      }
+      done = mGeneration;
+      job = mJob;
+    }
+    try {
+      (*job)(index);
+    } catch (...) {
+      mErrors[index] = std::current_exception();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      --mPending;
+    }
+    mDone.notify_one();
+  }
+}
+
+} // namespace o2::framework
@@ -14,7 +14,10 @@
 
 #include "arrow/type_traits.h"
 #include <arrow/util/key_value_metadata.h>
+#include <arrow/buffer.h>
 #include <TBufferFile.h>
+#include <cstring>
+#include <algorithm>
 
 namespace o2::framework
 {
@@ -63,6 +66,16 @@ class ColumnIterator
   std::shared_ptr<arrow::Field> mField;
   std::shared_ptr<arrow::Array> mArray;
 
+  // fixed width types (all but bool, which is bit-packed in arrow) are copied directly
+  // from the bulk read buffer to the values buffer of the array, bypassing the builders
+  bool mDirect = false;
+  int mElementSize = 0;
+  int64_t mValuesSize = 0; // bytes filled in mValues
+  std::shared_ptr<arrow::ResizableBuffer> mValues;
+
+  std::shared_ptr<arrow::DataType> getElementType() const { return mNumberElements == 1 ? mField->type() : mField->type()->field(0)->type(); }
+  bool reserveValues(int64_t nbytes);
+
  public:
   ColumnIterator(TTree* reader, const char* colname);
   ~ColumnIterator();
@@ -98,30 +111,43 @@ BranchIterator::BranchIterator(TTree* tree, std::shared_ptr<arrow::ChunkedArray>
   mLeaflistString = mBranchName;
   mElementType = mFieldType;
   mNumberElements = 1;
+  auto elementType = mField->type();
   if (mFieldType == arrow::Type::type::FIXED_SIZE_LIST) {
 
     // element type
     if (mField->type()->num_fields() <= 0) {
       LOGP(FATAL, "Field {} of type {} has no children!", mField->name(), mField->type()->ToString().c_str());
     }
-    mElementType = mField->type()->field(0)->type()->id();
+    elementType = mField->type()->field(0)->type();
+    mElementType = elementType->id();
     // number of elements
     mNumberElements = static_cast<const arrow::FixedSizeListType*>(mField->type().get())->list_size();
     mLeaflistString += "[" + std::to_string(mNumberElements) + "]";
   }
+  // bool is stored as 1 byte in the tree
+  auto elementSize = mElementType == arrow::Type::type::BOOL ? sizeof(bool) : static_cast<const arrow::FixedWidthType*>(elementType.get())->bit_width() / 8;
+  mRowSize = mNumberElements * elementSize;
+  if (mElementType == arrow::Type::type::BOOL) {
+    mBranchBuffer = new char[mRowSize];
+  }
 
   // initialize the branch
   mStatus = initBranch(tree);
+  if (mStatus && mBranchBuffer) {
+    mBranchPtr->SetAddress(mBranchBuffer);
+  }
 
+  // the first row is in the first non-empty chunk
   mCounterChunk = 0;
   mStatus &= initDataBuffer(mCounterChunk);
+  while (mNumberRows == 0 && ++mCounterChunk < mNumberChuncs) {
+    mStatus &= initDataBuffer(mCounterChunk);
+  }
 }
 
 BranchIterator::~BranchIterator()
 {
-  delete mBranchBuffer;
-
-  delete[] mVariable_o;
+  delete[] mBranchBuffer;
 }
 
 bool BranchIterator::getStatus()
@@ -177,85 +203,63 @@ bool BranchIterator::initBranch(TTree* tree)
       break;
   }
 
-  mBranchPtr = tree->Branch(mBranchName.c_str(), mBranchBuffer, mLeaflistString.c_str());
+  // the basket holds all rows of the column (up to the maximum size)
+  int64_t nRows = 0;
+  for (auto& chunk : mChunks) {
+    nRows += chunk->length();
+  }
+  int basketSize = std::clamp<int64_t>(nRows * mRowSize + 1024, 32000, TableToTree::MaxBasketSize);
+  mBranchPtr = tree->Branch(mBranchName.c_str(), mBranchBuffer, mLeaflistString.c_str(), basketSize);
   return mBranchPtr != nullptr;
 }
 
 bool BranchIterator::initDataBuffer(Int_t ib)
 {
+  // reset actual row number
+  mCounterRow = 0;
+  mNumberRows = 0;
+  if (ib >= mNumberChuncs) {
+    return true; // empty column
+  }
 
+  // reset number of rows mNumberRows
+  mNumberRows = mChunks.at(ib)->length();
+  if (!mNumberRows) {
+    return true;
+  }
+
+  // the values of a list chunk are not sliced, the offset of the list needs to be applied
   auto chunkToUse = mChunks.at(ib);
+  int64_t firstElement = 0;
   if (mFieldType == arrow::Type::type::FIXED_SIZE_LIST) {
+    firstElement = chunkToUse->offset() * mNumberElements;
     chunkToUse = std::dynamic_pointer_cast<arrow::FixedSizeListArray>(chunkToUse)->values();
   }
 
-  // reset actual row number
-  mCounterRow = 0;
-
-  // get next chunk of given data type mElementType
-  switch (mElementType) {
-    case arrow::Type::type::BOOL:
-      if (!mVariable_o) {
-        mVariable_o = new bool[mNumberElements];
-      }
-      mArray_o = std::dynamic_pointer_cast<arrow::BooleanArray>(chunkToUse);
-      for (int ii = 0; ii < mNumberElements; ii++) {
-        mVariable_o[ii] = (bool)mArray_o->Value(ii);
-      }
-      mValueBuffer = (void*)mVariable_o;
-      break;
-    case arrow::Type::type::UINT8:
-      mVariable_ub = (uint8_t*)std::dynamic_pointer_cast<arrow::UInt8Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_ub;
-      break;
-    case arrow::Type::type::UINT16:
-      mVariable_us = (uint16_t*)std::dynamic_pointer_cast<arrow::UInt16Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_us;
-      break;
-    case arrow::Type::type::UINT32:
-      mVariable_ui = (uint32_t*)std::dynamic_pointer_cast<arrow::UInt32Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_ui;
-      break;
-    case arrow::Type::type::UINT64:
-      mVariable_ul = (uint64_t*)std::dynamic_pointer_cast<arrow::UInt64Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_ul;
-      break;
-    case arrow::Type::type::INT8:
-      mVariable_b = (int8_t*)std::dynamic_pointer_cast<arrow::Int8Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_b;
-      break;
-    case arrow::Type::type::INT16:
-      mVariable_s = (int16_t*)std::dynamic_pointer_cast<arrow::Int16Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_s;
-      break;
-    case arrow::Type::type::INT32:
-      mVariable_i = (int32_t*)std::dynamic_pointer_cast<arrow::Int32Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_i;
-      break;
-    case arrow::Type::type::INT64:
-      mVariable_l = (int64_t*)std::dynamic_pointer_cast<arrow::Int64Array>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_l;
-      break;
-    case arrow::Type::type::FLOAT:
-      mVariable_f = (Float_t*)std::dynamic_pointer_cast<arrow::FloatArray>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_f;
-      break;
-    case arrow::Type::type::DOUBLE:
-      mVariable_d = (double*)std::dynamic_pointer_cast<arrow::DoubleArray>(chunkToUse)->raw_values();
-      mValueBuffer = (void*)mVariable_d;
-    default:
-      break;
-      LOGP(FATAL, "Type {} not handled!", mElementType);
-      break;
+  if (mElementType == arrow::Type::type::BOOL) {
+    mArray_o = std::dynamic_pointer_cast<arrow::BooleanArray>(chunkToUse);
+    mFirstElement_o = firstElement;
+  } else {
+    firstElement += chunkToUse->offset();
+    mCurrentRow = reinterpret_cast<const char*>(chunkToUse->data()->buffers[1]->data()) + firstElement * (mRowSize / mNumberElements);
   }
-  mBranchPtr->SetAddress(mValueBuffer);
-
-  // reset number of rows mNumberRows and row counter mCounterRow
-  mNumberRows = mChunks.at(ib)->length();
+  setRow();
 
   return true;
 }
 
+void BranchIterator::setRow()
+{
+  if (mElementType == arrow::Type::type::BOOL) {
+    auto* dest = reinterpret_cast<bool*>(mBranchBuffer);
+    for (int ii = 0; ii < mNumberElements; ii++) {
+      dest[ii] = mArray_o->Value(mFirstElement_o + mCounterRow * mNumberElements + ii);
+    }
+  } else {
+    mBranchPtr->SetAddress(const_cast<char*>(mCurrentRow));
+  }
+}
+
 bool BranchIterator::push()
 {
   // increment row counter
@@ -263,70 +267,22 @@ bool BranchIterator::push()
 
   // mCounterChunk and mCounterRow contain the current chunk and row
   // return the next element if available
-  if (mCounterRow >= mNumberRows) {
-    mCounterChunk++;
-    if (mCounterChunk < mNumberChuncs) {
-      initDataBuffer(mCounterChunk);
-    } else {
-      // end of data buffer reached
-      return false;
-    }
-  } else {
-    switch (mElementType) {
-      case arrow::Type::type::BOOL:
-        for (int ii = 0; ii < mNumberElements; ii++) {
-          mVariable_o[ii] = (bool)mArray_o->Value(mCounterRow * mNumberElements + ii);
-        }
-        mValueBuffer = (void*)mVariable_o;
-        break;
-      case arrow::Type::type::UINT8:
-        mVariable_ub += mNumberElements;
-        mValueBuffer = (void*)mVariable_ub;
-        break;
-      case arrow::Type::type::UINT16:
-        mVariable_us += mNumberElements;
-        mValueBuffer = (void*)mVariable_us;
-        break;
-      case arrow::Type::type::UINT32:
-        mVariable_ui += mNumberElements;
-        mValueBuffer = (void*)mVariable_ui;
-        break;
-      case arrow::Type::type::UINT64:
-        mVariable_ul += mNumberElements;
-        mValueBuffer = (void*)mVariable_ul;
-        break;
-      case arrow::Type::type::INT8:
-        mVariable_b += mNumberElements;
-        mValueBuffer = (void*)mVariable_b;
-        break;
-      case arrow::Type::type::INT16:
-        mVariable_s += mNumberElements;
-        mValueBuffer = (void*)mVariable_s;
-        break;
-      case arrow::Type::type::INT32:
-        mVariable_i += mNumberElements;
-        mValueBuffer = (void*)mVariable_i;
-        break;
-      case arrow::Type::type::INT64:
-        mVariable_l += mNumberElements;
-        mValueBuffer = (void*)mVariable_l;
-        break;
-      case arrow::Type::type::FLOAT:
-        mVariable_f += mNumberElements;
-        mValueBuffer = (void*)mVariable_f;
-        break;
-      case arrow::Type::type::DOUBLE:
-        mVariable_d += mNumberElements;
-        mValueBuffer = (void*)mVariable_d;
-        break;
-      default:
-        LOGP(FATAL, "Type {} not handled!", mElementType);
-        break;
+  if (mCounterRow < mNumberRows) {
+    mCurrentRow += mRowSize;
+    setRow();
+    return true;
+  }
+
+  // move to the next non-empty chunk
+  while (++mCounterChunk < mNumberChuncs) {
+    initDataBuffer(mCounterChunk);
+    if (mNumberRows) {
+      return true;
     }
   }
-  mBranchPtr->SetAddress(mValueBuffer);
 
-  return true;
+  // end of data buffer reached
+  return false;
 }
 
 TableToTree::TableToTree(std::shared_ptr<arrow::Table> table,
@@ -533,6 +489,10 @@ ColumnIterator::ColumnIterator(TTree* tree, const char* colname)
         break;
     }
   }
+  if (mElementType != EDataType::kBool_t) {
+    mDirect = true;
+    mElementSize = static_cast<const arrow::FixedWidthType*>(getElementType().get())->bit_width() / 8;
+  }
 }
 
 ColumnIterator::~ColumnIterator()
@@ -559,8 +519,27 @@ bool ColumnIterator::getStatus()
   return mStatus;
 }
 
+bool ColumnIterator::reserveValues(int64_t nbytes)
+{
+  if (!mValues) {
+    auto res = arrow::AllocateResizableBuffer(nbytes);
+    if (!res.ok()) {
+      return false;
+    }
+    mValues = std::move(res).ValueOrDie();
+    return true;
+  }
+  return nbytes <= mValues->capacity() || mValues->Reserve(nbytes).ok();
+}
+
 void ColumnIterator::reserve(size_t s)
 {
+  if (mDirect) {
+    if (!reserveValues(s * mNumberElements * mElementSize)) {
+      LOGP(FATAL, "Failed to allocate {} entries for column {}", s, mColumnName);
+    }
+    return;
+  }
   arrow::Status stat;
   if (mNumberElements != 1) {
     stat = mTableBuilder_list->Reserve(s);
@@ -627,6 +606,16 @@ size_t ColumnIterator::push()
   }
   mPos += size;
 
+  if (mDirect) {
+    int64_t nbytes = size * mNumberElements * mElementSize;
+    if (!reserveValues(mValuesSize + nbytes)) {
+      LOGP(FATAL, "Failed to allocate {} bytes for column {}", mValuesSize + nbytes, mColumnName);
+    }
+    std::memcpy(mValues->mutable_data() + mValuesSize, buffer.GetCurrent(), nbytes);
+    mValuesSize += nbytes;
+    return size;
+  }
+
   // switch according to mElementType
   switch (mElementType) {
     case EDataType::kBool_t:
@@ -676,6 +665,21 @@ void ColumnIterator::finish()
 {
   arrow::Status stat;
 
+  if (mDirect) {
+    if (!reserveValues(mValuesSize) || !mValues->Resize(mValuesSize, false).ok()) {
+      LOGP(FATAL, "Failed to finalize column {}", mColumnName);
+    }
+    // no validity bitmap: the tree columns have no null entries
+    int64_t nValues = mValuesSize / mElementSize;
+    auto values = arrow::ArrayData::Make(getElementType(), nValues, {nullptr, mValues}, 0);
+    if (mNumberElements == 1) {
+      mArray = arrow::MakeArray(values);
+    } else {
+      mArray = arrow::MakeArray(arrow::ArrayData::Make(mField->type(), nValues / mNumberElements, {nullptr}, {values}, 0));
+    }
+    return;
+  }
+
   if (mNumberElements != 1) {
     stat = mTableBuilder_list->Finish(&mArray);
     return;
@@ -14,6 +14,7 @@
 
 #include "Framework/AnalysisTask.h"
 #include "Framework/AnalysisDataModel.h"
+#include "Framework/HistogramRegistry.h"
 
 #include <boost/test/unit_test.hpp>
 
@@ -108,6 +109,49 @@ BOOST_AUTO_TEST_CASE(GroupSlicerOneAssociated)
   }
 }
 
+BOOST_AUTO_TEST_CASE(GroupSlicerSharedCache)
+{
+  TableBuilder builderE;
+  auto evtsWriter = builderE.cursor<aod::Events>();
+  for (auto i = 0; i < 20; ++i) {
+    evtsWriter(0, i, 0.5f * i, 2.f * i, 3.f * i);
+  }
+  auto evtTable = builderE.finalize();
+
+  TableBuilder builderT;
+  auto trksWriter = builderT.cursor<aod::TrksX>();
+  for (auto i = 0; i < 20; ++i) {
+    for (auto j = 0.f; j < 5; j += 0.5f) {
+      trksWriter(0, i, 0.5f * j);
+    }
+  }
+  auto trkTable = builderT.finalize();
+  aod::Events e{evtTable};
+
+  ArrowTableSlicingCache cache;
+  // the tables are recreated for each slicer, as it happens for different process functions
+  for (auto pass = 0; pass < 2; ++pass) {
+    aod::TrksX t{trkTable};
+    auto tt = std::make_tuple(t);
+    o2::framework::AnalysisDataProcessorBuilder::GroupSlicer g(e, tt, cache);
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+
+    unsigned int count = 0;
+    for (auto& slice : g) {
+      auto as = slice.associatedTables();
+      auto trks = std::get<aod::TrksX>(as);
+      BOOST_CHECK_EQUAL(trks.size(), 10);
+      for (auto& trk : trks) {
+        BOOST_CHECK_EQUAL(trk.eventId(), count);
+      }
+      ++count;
+    }
+    BOOST_CHECK_EQUAL(count, 20);
+  }
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(GroupSlicerSeveralAssociated)
 {
   TableBuilder builderE;
@@ -378,3 +422,111 @@ BOOST_AUTO_TEST_CASE(ArrowDirectSlicing)
     BOOST_CHECK(cb->Equals(slices_bool[i]));
   }
 }
+
+struct GroupHistogramsTask {
+  HistogramRegistry registry{
+    "registry", {
+                  {"x", "x", {HistType::kTH1F, {{100, 0., 5.}}}},                        //
+                  {"nSmall", "nSmall", {HistType::kTH2F, {{20, 0., 20.}, {10, 0., 10.}}}} //
+                }                                                                        //
+  };
+  Partition<aod::TrksX> small = aod::test::x < 1.0f;
+
+  void process(aod::Event const& event, aod::TrksX const& tracks)
+  {
+    for (auto& track : tracks) {
+      registry.fill(HIST("x"), track.x());
+    }
+    registry.fill(HIST("nSmall"), event.globalIndex(), small.size());
+  }
+};
+
+struct GroupProducesTask {
+  Produces<aod::TrksU> trksU;
+  HistogramRegistry registry{"registry", {{"x", "x", {HistType::kTH1F, {{100, 0., 5.}}}}}};
+
+  void process(aod::Event const&, aod::TrksX const& tracks)
+  {
+    for (auto& track : tracks) {
+      trksU(track.x(), 0.f, 0.f);
+    }
+  }
+};
+
+struct GroupServiceTask {
+  Service<ArrowTableSlicingCache> cache;
+  HistogramRegistry registry{"registry", {{"x", "x", {HistType::kTH1F, {{100, 0., 5.}}}}}};
+
+  void process(aod::Event const&, aod::TrksX const& tracks)
+  {
+    for (auto& track : tracks) {
+      registry.fill(HIST("x"), track.x());
+    }
+  }
+};
+
+BOOST_AUTO_TEST_CASE(GroupsProcessedConcurrently)
+{
+  TableBuilder builderE;
+  auto evtsWriter = builderE.cursor<aod::Events>();
+  for (auto i = 0; i < 20; ++i) {
+    evtsWriter(0, i, 0.5f * i, 2.f * i, 3.f * i);
+  }
+  auto evtTable = builderE.finalize();
+
+  // groups of different sizes, some of them empty
+  TableBuilder builderT;
+  auto trksWriter = builderT.cursor<aod::TrksX>();
+  for (auto i = 0; i < 20; ++i) {
+    for (auto j = 0; j < i % 6; ++j) {
+      trksWriter(0, i, 0.1f * i + 0.3f * j);
+    }
+  }
+  auto trkTable = builderT.finalize();
+  aod::Events e{evtTable};
+  aod::TrksX t{trkTable};
+  auto tt = std::make_tuple(t);
+
+  using Builder = AnalysisDataProcessorBuilder;
+  ArrowTableSlicingCache cache;
+
+  GroupHistogramsTask serial;
+  Builder::setPartitions(serial, e);
+  Builder::bindFullTables(serial, e, tt);
+  Builder::GroupSlicer slicer(e, tt, cache);
+  for (auto& slice : slicer) {
+    Builder::processGroup(serial, &GroupHistogramsTask::process, e, tt, slice);
+  }
+
+  for (auto nThreads : {2, 3, 8}) {
+    GroupHistogramsTask task;
+    auto copies = makeThreadCopies(task, nThreads);
+    BOOST_REQUIRE_EQUAL(copies.copies.size(), nThreads - 1);
+    // the threads are reused by the following timeframes
+    for (auto timeframe = 0; timeframe < 2; ++timeframe) {
+      Builder::processGroupsConcurrently(task, copies, &GroupHistogramsTask::process, e, tt, cache);
+    }
+    for (auto& copy : copies.copies) {
+      applyToThreadCopy([](auto& x, auto& y) { return OutputManager<std::decay_t<decltype(x)>>::mergeThreadCopy(x, y); }, task, *copy);
+    }
+
+    // two timeframes were processed, the serial reference has seen one
+    auto checkTwice = [](TH1* result, TH1* reference) {
+      BOOST_CHECK_EQUAL(result->GetEntries(), 2 * reference->GetEntries());
+      for (auto bin = 0; bin < reference->GetNcells(); ++bin) {
+        BOOST_CHECK_EQUAL(result->GetBinContent(bin), 2 * reference->GetBinContent(bin));
+      }
+    };
+    checkTwice(task.registry.get<TH1>(HIST("x")).get(), serial.registry.get<TH1>(HIST("x")).get());
+    checkTwice(task.registry.get<TH2>(HIST("nSmall")).get(), serial.registry.get<TH2>(HIST("nSmall")).get());
+  }
+
+  // the rows of a produced table are numbered in the order they are written, thus
+  // tasks producing tables are processed in a single thread
+  GroupProducesTask producesTask;
+  BOOST_CHECK(makeThreadCopies(producesTask, 4).empty());
+
+  // the copies would share the services, which are not known to be thread-safe
+  GroupServiceTask serviceTask;
+  BOOST_CHECK(makeThreadCopies(serviceTask, 4).empty());
+}
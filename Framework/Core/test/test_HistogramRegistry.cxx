@@ -129,3 +129,79 @@ BOOST_AUTO_TEST_CASE(HistogramRegistryStepTHn)
 
   registry.print();
 }
+
+BOOST_AUTO_TEST_CASE(HistogramRegistryMergeCopy)
+{
+  HistogramRegistry registry{
+    "registry", {
+                  {"eta", "#Eta", {HistType::kTH1F, {{100, -2.0, 2.0}}}},                             //
+                  {"ptToPt", "#ptToPt", {HistType::kTH2F, {{100, -0.01, 10.01}, {100, -0.01, 10.01}}}} //
+                }                                                                                     //
+  };
+  registry.fill(HIST("eta"), 0.5);
+
+  /// a detached copy does not share the histograms with the original
+  auto copy = registry;
+  copy.detachHistograms();
+  BOOST_CHECK(copy.get<TH1>(HIST("eta")) != registry.get<TH1>(HIST("eta")));
+  BOOST_CHECK_EQUAL(copy.get<TH1>(HIST("eta"))->GetEntries(), 0);
+
+  copy.fill(HIST("eta"), 1.5);
+  copy.fill(HIST("ptToPt"), 1.0, 2.0);
+  BOOST_CHECK_EQUAL(registry.get<TH1>(HIST("eta"))->GetEntries(), 1);
+
+  registry.merge(copy);
+  BOOST_CHECK_EQUAL(registry.get<TH1>(HIST("eta"))->GetEntries(), 2);
+  BOOST_CHECK_EQUAL(registry.get<TH2>(HIST("ptToPt"))->GetEntries(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramRegistryColumnFill)
+{
+  TableBuilder builder;
+  auto rowWriter = builder.persist<float, float>({"x", "y"});
+  for (int i = 0; i < 3000; ++i) {
+    rowWriter(0, 0.01f * (i % 1200) - 1.0f, 0.5f * (i % 7));
+  }
+  using TestA = o2::soa::Table<o2::soa::Index<>, test::X, test::Y>;
+  TestA tests{builder.finalize()};
+
+  HistogramRegistry registry{
+    "registry", {
+                  {"x", "test x", {HistType::kTH1F, {{100, 0.0f, 10.0f}}}},                                                //
+                  {"xw", "test x weighted", {HistType::kTH1D, {AxisSpec{std::vector<double>{0., 0.5, 1., 2., 5., 10.}}}}}, //
+                  {"xy", "test xy", {HistType::kTH2F, {{100, -1.0f, 10.01f}, {10, -1.0f, 3.0f}}}}                          //
+                }                                                                                                          //
+  };
+  registry.fill<test::X>(HIST("x"), tests, test::x > 0.5f);
+  registry.fill<test::X, test::Y>(HIST("xw"), tests, test::x > 0.5f);
+  registry.fill<test::X, test::Y>(HIST("xy"), tests, test::x > 0.5f);
+
+  /// the same histograms filled row by row
+  auto x = std::unique_ptr<TH1>(static_cast<TH1*>(registry.get<TH1>(HIST("x"))->Clone()));
+  auto xw = std::unique_ptr<TH1>(static_cast<TH1*>(registry.get<TH1>(HIST("xw"))->Clone()));
+  auto xy = std::unique_ptr<TH2>(static_cast<TH2*>(registry.get<TH2>(HIST("xy"))->Clone()));
+  x->Reset();
+  xw->Reset();
+  xy->Reset();
+  for (auto& row : tests) {
+    if (row.x() > 0.5f) {
+      x->Fill(row.x());
+      xw->Fill(row.x(), row.y());
+      xy->Fill(row.x(), row.y());
+    }
+  }
+
+  auto compare = [](TH1* reference, TH1* hist) {
+    BOOST_CHECK_EQUAL(reference->GetEntries(), hist->GetEntries());
+    BOOST_CHECK_CLOSE(reference->GetMean(1), hist->GetMean(1), 1e-6);
+    BOOST_CHECK_CLOSE(reference->GetStdDev(1), hist->GetStdDev(1), 1e-6);
+    BOOST_CHECK_CLOSE(reference->GetMean(2), hist->GetMean(2), 1e-6);
+    for (int bin = 0; bin < reference->GetNcells(); ++bin) {
+      BOOST_CHECK_CLOSE(reference->GetBinContent(bin), hist->GetBinContent(bin), 1e-6);
+      BOOST_CHECK_CLOSE(reference->GetBinError(bin), hist->GetBinError(bin), 1e-6);
+    }
+  };
+  compare(x.get(), registry.get<TH1>(HIST("x")).get());
+  compare(xw.get(), registry.get<TH1>(HIST("xw")).get());
+  compare(xy.get(), registry.get<TH2>(HIST("xy")).get());
+}
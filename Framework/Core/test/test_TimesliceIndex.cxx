@@ -99,3 +99,47 @@ BOOST_AUTO_TEST_CASE(TestLRUReplacement)
     BOOST_CHECK(action == TimesliceIndex::ActionTaken::Wait);
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestFindSlotForTimeslice)
+{
+  using namespace o2::framework;
+  TimesliceIndex index{1};
+  index.resize(3);
+  BOOST_CHECK(TimesliceSlot::isValid(index.findSlotForTimeslice({10})) == false);
+  BOOST_CHECK(index.hasDirtySlots() == false);
+
+  index.associate(TimesliceId{10}, TimesliceSlot{0});
+  index.associate(TimesliceId{20}, TimesliceSlot{1});
+  BOOST_CHECK(index.hasDirtySlots());
+  BOOST_CHECK_EQUAL(index.findSlotForTimeslice({10}).index, 0);
+  BOOST_CHECK_EQUAL(index.findSlotForTimeslice({20}).index, 1);
+
+  // reassociating the slot removes the old timeslice from the index
+  index.associate(TimesliceId{30}, TimesliceSlot{0});
+  BOOST_CHECK(TimesliceSlot::isValid(index.findSlotForTimeslice({10})) == false);
+  BOOST_CHECK_EQUAL(index.findSlotForTimeslice({30}).index, 0);
+
+  // invalid slots cannot be found
+  index.markAsInvalid(TimesliceSlot{1});
+  BOOST_CHECK(TimesliceSlot::isValid(index.findSlotForTimeslice({20})) == false);
+
+  // slots filled by the LRU replacement can be found
+  data_matcher::VariableContext context;
+  context.put({0, uint64_t{40}});
+  context.commit();
+  auto [action, slot] = index.replaceLRUWith(context, {40});
+  BOOST_CHECK(action == TimesliceIndex::ActionTaken::ReplaceUnused);
+  BOOST_CHECK_EQUAL(index.findSlotForTimeslice({40}).index, slot.index);
+
+  // variables bound outside of the index are picked up when publishing the slot
+  auto& variables = index.getVariablesForSlot(TimesliceSlot{2});
+  variables.put({0, uint64_t{50}});
+  variables.commit();
+  index.publishSlot(TimesliceSlot{2});
+  BOOST_CHECK_EQUAL(index.findSlotForTimeslice({50}).index, 2);
+
+  index.markAsDirty(TimesliceSlot{0}, false);
+  BOOST_CHECK(index.hasDirtySlots()); // slot 1 is still dirty
+  index.markAsDirty(TimesliceSlot{1}, false);
+  BOOST_CHECK(index.hasDirtySlots() == false);
+}
@@ -21,6 +21,7 @@
 
 #include <TTree.h>
 #include <TRandom.h>
+#include <arrow/builder.h>
 #include <arrow/table.h>
 
 BOOST_AUTO_TEST_CASE(TreeToTableConversion)
@@ -106,6 +107,19 @@ BOOST_AUTO_TEST_CASE(TreeToTableConversion)
   BOOST_REQUIRE_EQUAL(table->column(7)->type()->id(), arrow::fixed_size_list(arrow::float32(), 96)->id());
   BOOST_REQUIRE_EQUAL(table->column(8)->type()->id(), arrow::fixed_size_list(arrow::boolean(), 5)->id());
 
+  // values of the fixed width columns (copied directly from the bulk read buffers)
+  auto evs = std::dynamic_pointer_cast<arrow::Int32Array>(table->column(5)->chunk(0));
+  BOOST_REQUIRE_NE(evs.get(), nullptr);
+  BOOST_REQUIRE_EQUAL(evs->null_count(), 0);
+  auto ijs = std::static_pointer_cast<arrow::DoubleArray>(std::static_pointer_cast<arrow::FixedSizeListArray>(table->column(6)->chunk(0))->values());
+  BOOST_REQUIRE_EQUAL(ijs->length(), ndp * nelem);
+  for (int ii = 0; ii < ndp; ii++) {
+    BOOST_CHECK_EQUAL(evs->Value(ii), ii + 1);
+    for (int jj = 0; jj < nelem; jj++) {
+      BOOST_CHECK_EQUAL(ijs->Value(ii * nelem + jj), ii + 100 * jj);
+    }
+  }
+
   // count number of rows with ok==true
   int ntrueout = 0;
   auto chunks = table->column(0);
@@ -147,3 +161,66 @@ BOOST_AUTO_TEST_CASE(TreeToTableConversion)
 
   f2->Close();
 }
+
+BOOST_AUTO_TEST_CASE(TableToTreeSlicedAndEmptyChunks)
+{
+  using namespace o2::framework;
+
+  // chunks with the rows [first, last): i, {i, 10 * i} and i % 3 == 0
+  auto makeChunks = [](int first, int last) {
+    arrow::Int32Builder intBuilder;
+    auto floatBuilder = std::make_shared<arrow::FloatBuilder>();
+    arrow::FixedSizeListBuilder listBuilder(arrow::default_memory_pool(), floatBuilder, 2);
+    arrow::BooleanBuilder boolBuilder;
+    for (int i = first; i < last; i++) {
+      BOOST_REQUIRE(intBuilder.Append(i).ok());
+      BOOST_REQUIRE(listBuilder.Append().ok());
+      BOOST_REQUIRE(floatBuilder->Append(i).ok());
+      BOOST_REQUIRE(floatBuilder->Append(10 * i).ok());
+      BOOST_REQUIRE(boolBuilder.Append(i % 3 == 0).ok());
+    }
+    std::array<std::shared_ptr<arrow::Array>, 3> chunks;
+    BOOST_REQUIRE(intBuilder.Finish(&chunks[0]).ok());
+    BOOST_REQUIRE(listBuilder.Finish(&chunks[1]).ok());
+    BOOST_REQUIRE(boolBuilder.Finish(&chunks[2]).ok());
+    return chunks;
+  };
+
+  // an empty chunk first, a chunk with an offset, another empty chunk and a last chunk: the rows 2 to 12
+  std::vector<std::array<std::shared_ptr<arrow::Array>, 3>> chunks = {makeChunks(0, 0), makeChunks(0, 10), makeChunks(0, 0), makeChunks(10, 13)};
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  for (int col = 0; col < 3; col++) {
+    arrow::ArrayVector colChunks;
+    for (auto& chunk : chunks) {
+      colChunks.push_back(chunk[col]);
+    }
+    colChunks[1] = colChunks[1]->Slice(2);
+    columns.push_back(std::make_shared<arrow::ChunkedArray>(colChunks));
+  }
+  auto schema = arrow::schema({arrow::field("i", arrow::int32()),
+                               arrow::field("xy", arrow::fixed_size_list(arrow::float32(), 2)),
+                               arrow::field("b", arrow::boolean())});
+  auto table = arrow::Table::Make(schema, columns);
+  BOOST_REQUIRE_EQUAL(table->num_rows(), 11);
+
+  TFile f("table2treechunks.root", "RECREATE");
+  TableToTree ta2tr(table, &f, "chunks");
+  BOOST_REQUIRE(ta2tr.addAllBranches());
+  auto t = ta2tr.process();
+  BOOST_REQUIRE_EQUAL(t->GetEntries(), 11);
+
+  Int_t i;
+  Float_t xy[2];
+  Bool_t b;
+  t->SetBranchAddress("i", &i);
+  t->SetBranchAddress("xy", xy);
+  t->SetBranchAddress("b", &b);
+  for (int entry = 0; entry < t->GetEntries(); entry++) {
+    t->GetEntry(entry);
+    BOOST_CHECK_EQUAL(i, entry + 2);
+    BOOST_CHECK_EQUAL(xy[0], entry + 2);
+    BOOST_CHECK_EQUAL(xy[1], 10 * (entry + 2));
+    BOOST_CHECK_EQUAL(b, (entry + 2) % 3 == 0);
+  }
+  f.Close();
+}
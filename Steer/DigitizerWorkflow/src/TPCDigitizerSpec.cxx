@@ -27,6 +27,7 @@
 #include "TStopwatch.h"
 #include "Steer/HitProcessingManager.h" // for DigitizationContext
 #include "TChain.h"
+#include "TROOT.h"
 #include <SimulationDataFormat/MCCompLabel.h>
 #include <SimulationDataFormat/ConstMCTruthContainer.h>
 #include <SimulationDataFormat/IOMCTruthContainerView.h>
@@ -171,6 +172,22 @@ class TPCDPLDigitizerTask : public BaseDPLDigitizer
     }
     mDigitizer.setContinuousReadout(!triggeredMode);
 
+    mNThreads = std::max(1, ic.options().get<int>("nthreads"));
+#ifndef WITH_OPENMP
+    if (mNThreads > 1) {
+      LOG(WARNING) << "TPC: multithreading is not supported, digitizing the sectors sequentially";
+      mNThreads = 1;
+    }
+#endif
+    if (mNThreads > 1 && (useDistortions > 0 || mInternalWriter)) {
+      LOG(WARNING) << "TPC: multithreaded digitization is not supported with space-charge distortions or the chunked writer, digitizing the sectors sequentially";
+      mNThreads = 1;
+    }
+    if (mNThreads > 1) {
+      // every thread reads its hits from its own chains
+      ROOT::EnableThreadSafety();
+    }
+
     // we send the GRP data once if the corresponding output channel is available
     // and set the flag to false after
     mWriteGRP = true;
@@ -223,6 +240,17 @@ class TPCDPLDigitizerTask : public BaseDPLDigitizer
       cdb.setGainMapFromFile("GainMap.root");
     }
 
+    if (mNThreads > 1) {
+      std::vector<framework::DataRef> inputrefs;
+      for (auto it = pc.inputs().begin(), end = pc.inputs().end(); it != end; ++it) {
+        for (auto const& inputref : it) {
+          inputrefs.push_back(inputref);
+        }
+      }
+      processSectors(pc, inputrefs);
+      return;
+    }
+
     for (auto it = pc.inputs().begin(), end = pc.inputs().end(); it != end; ++it) {
       for (auto const& inputref : it) {
         process(pc, inputref);
@@ -434,9 +462,180 @@ class TPCDPLDigitizerTask : public BaseDPLDigitizer
     LOG(INFO) << "TPC: Digitization took " << timer.CpuTime() << "s";
   }
 
+  // input and output of the digitization of one sector in the multithreaded mode
+  struct SectorTask {
+    o2::header::DataHeader const* dh = nullptr;
+    int sector = -1;
+    uint64_t activeSectors = 0;
+    std::vector<o2::tpc::Digit> digits;
+    o2::dataformats::MCTruthContainer<o2::MCCompLabel> labels;
+    std::vector<o2::tpc::CommonMode> commonMode;
+    std::vector<DigiGroupRef> events;
+  };
+
+  // process all sectors concurrently: each sector is always digitized by the same digitizer, which reads its hits
+  // from its own chains, and the outputs are sent in the order of the inputs
+  void processSectors(framework::ProcessingContext& pc, std::vector<framework::DataRef> const& inputrefs)
+  {
+    if (inputrefs.empty()) {
+      return;
+    }
+
+    // all the inputs carry the same collision context
+    auto context = pc.inputs().get<o2::steer::DigitizationContext*>(inputrefs[0]);
+    context->initSimChains(o2::detectors::DetID::TPC, mSimChains);
+    auto& irecords = context->getEventRecords();
+    LOG(INFO) << "TPC: Processing " << irecords.size() << " collisions in " << inputrefs.size() << " sectors with " << mNThreads << " threads";
+    if (irecords.size() == 0) {
+      return;
+    }
+    auto& eventParts = context->getEventParts();
+
+    bool isContinuous = mDigitizer.isContinuousReadout();
+    // we publish the GRP data once if the output channel is there
+    if (mWriteGRP && pc.outputs().isAllowed({"TPC", "ROMode", 0})) {
+      auto roMode = isContinuous ? o2::parameters::GRPObject::CONTINUOUS : o2::parameters::GRPObject::PRESENT;
+      LOG(INFO) << "TPC: Sending ROMode= " << (isContinuous ? "Continuous" : "Triggered") << " to GRPUpdater";
+      pc.outputs().snapshot(Output{"TPC", "ROMode", 0, Lifetime::Timeframe}, roMode);
+    }
+    mWriteGRP = false;
+
+    // one digitizer per thread, with its own random number streams (the first one uses the shared ones)
+    for (int i = mThreadDigitizers.size() + 1; i < mNThreads; ++i) {
+      auto& digitizer = mThreadDigitizers.emplace_back(std::make_unique<o2::tpc::Digitizer>());
+      digitizer->usePrivateRandomStreams();
+      digitizer->setContinuousReadout(isContinuous);
+    }
+    mThreadSimChains.resize(mNThreads - 1);
+    for (auto& chains : mThreadSimChains) {
+      context->initSimChains(o2::detectors::DetID::TPC, chains);
+    }
+
+    std::vector<SectorTask> tasks;
+    tasks.reserve(inputrefs.size());
+    for (auto const& inputref : inputrefs) {
+      auto const* sectorHeader = DataRefUtils::getHeader<TPCSectorHeader*>(inputref);
+      if (sectorHeader == nullptr) {
+        LOG(ERROR) << "TPC: Sector header missing, skipping processing";
+        continue;
+      }
+      auto sector = sectorHeader->sector();
+      if (sector < 0) {
+        throw std::runtime_error("Legacy control information is not expected any more");
+      }
+      if (sector >= TPCSectorHeader::NSectors) {
+        throw std::runtime_error("Digitizer can only work on single sectors");
+      }
+      mListOfSectors.push_back(sector);
+      auto& task = tasks.emplace_back();
+      task.dh = DataRefUtils::getHeader<o2::header::DataHeader*>(inputref);
+      task.sector = sector;
+      task.activeSectors = sectorHeader->activeSectors;
+    }
+
+    TStopwatch timer;
+    timer.Start();
+
+    // The random number streams of the digitizers persist over the timeframes, thus each sector is assigned to
+    // a fixed digitizer, which processes its sectors in the order of the inputs. The result does not depend on
+    // the scheduling of the threads, only on their number.
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(mNThreads)
+#endif
+    for (int iDigitizer = 0; iDigitizer < mNThreads; ++iDigitizer) {
+      auto& digitizer = (iDigitizer == 0) ? mDigitizer : *mThreadDigitizers[iDigitizer - 1];
+      auto const& chains = (iDigitizer == 0) ? mSimChains : mThreadSimChains[iDigitizer - 1];
+      for (auto& task : tasks) {
+        if (task.sector % mNThreads == iDigitizer) {
+          digitizeSector(digitizer, chains, *context, task, irecords, eventParts, isContinuous);
+        }
+      }
+    }
+
+    timer.Stop();
+    LOG(INFO) << "TPC: Digitization of " << tasks.size() << " sectors took " << timer.RealTime() << "s";
+
+    // send out to next stage
+    for (auto& task : tasks) {
+      o2::tpc::TPCSectorHeader header{task.sector};
+      header.activeSectors = task.activeSectors;
+      auto subSpec = static_cast<SubSpecificationType>(task.dh->subSpecification);
+      LOG(INFO) << "TPC: Sector " << task.sector << ": " << task.digits.size() << " digits, " << task.labels.getNElements() << " labels and " << task.commonMode.size() << " common mode entries";
+      pc.outputs().snapshot(Output{"TPC", "DIGITS", subSpec, Lifetime::Timeframe, header}, task.digits);
+      pc.outputs().snapshot(Output{"TPC", "DIGTRIGGERS", subSpec, Lifetime::Timeframe, header}, task.events);
+      pc.outputs().snapshot(Output{"TPC", "COMMONMODE", subSpec, Lifetime::Timeframe, header}, task.commonMode);
+      if (mWithMCTruth) {
+        auto& sharedlabels = pc.outputs().make<o2::dataformats::ConstMCTruthContainer<o2::MCCompLabel>>(Output{"TPC", "DIGITSMCTR", subSpec, Lifetime::Timeframe, header});
+        task.labels.flatten_to(sharedlabels);
+      }
+    }
+  }
+
+  // digitize all collisions of one sector with the given digitizer, reading the hits of each event part from the given chains
+  template <typename IRecords, typename EventParts>
+  void digitizeSector(o2::tpc::Digitizer& digitizer, std::vector<TChain*> const& chains, o2::steer::DigitizationContext const& context,
+                      SectorTask& task, IRecords const& irecords, EventParts const& eventParts, bool isContinuous)
+  {
+    digitizer.setSector(task.sector);
+    digitizer.init();
+
+    std::vector<o2::tpc::Digit> digits;
+    o2::dataformats::MCTruthContainer<o2::MCCompLabel> labels;
+    std::vector<o2::tpc::CommonMode> commonMode;
+    auto flushDigitsAndLabels = [this, &digitizer, &task, &digits, &labels, &commonMode](bool finalFlush = false) {
+      digits.clear();
+      labels.clear();
+      commonMode.clear();
+      digitizer.flush(digits, labels, commonMode, finalFlush);
+      std::copy(digits.begin(), digits.end(), std::back_inserter(task.digits));
+      if (mWithMCTruth) {
+        task.labels.mergeAtBack(labels);
+      }
+      std::copy(commonMode.begin(), commonMode.end(), std::back_inserter(task.commonMode));
+    };
+
+    if (isContinuous) {
+      auto& hbfu = o2::raw::HBFUtils::Instance();
+      double time = hbfu.getFirstIRofTF(o2::InteractionRecord(0, hbfu.orbitFirstSampled)).bc2ns() / 1000.;
+      digitizer.setOutputDigitTimeOffset(time);
+      digitizer.setStartTime(irecords[0].getTimeNS() / 1000.f);
+    }
+
+    std::vector<o2::tpc::HitGroup> hitsLeft;
+    std::vector<o2::tpc::HitGroup> hitsRight;
+    for (int collID = 0; collID < irecords.size(); ++collID) {
+      const double eventTime = irecords[collID].getTimeNS() / 1000.f;
+      digitizer.setEventTime(eventTime);
+      if (!isContinuous) {
+        digitizer.setStartTime(eventTime);
+      }
+      size_t startSize = task.digits.size();
+      for (auto& part : eventParts[collID]) {
+        context.retrieveHits(chains, getBranchNameLeft(task.sector).c_str(), part.sourceID, part.entryID, &hitsLeft);
+        context.retrieveHits(chains, getBranchNameRight(task.sector).c_str(), part.sourceID, part.entryID, &hitsRight);
+        digitizer.process(hitsLeft, part.entryID, part.sourceID);
+        digitizer.process(hitsRight, part.entryID, part.sourceID);
+
+        flushDigitsAndLabels();
+
+        if (!isContinuous) {
+          task.events.emplace_back(startSize, digits.size());
+        }
+      }
+    }
+
+    // final flushing step; getting everything not yet written out
+    if (isContinuous) {
+      flushDigitsAndLabels(true);
+      task.events.emplace_back(0, task.digits.size()); // all digits are grouped to 1 super-event pseudo-triggered mode
+    }
+  }
+
  private:
   o2::tpc::Digitizer mDigitizer;
+  std::vector<std::unique_ptr<o2::tpc::Digitizer>> mThreadDigitizers; // digitizers of the additional threads
   std::vector<TChain*> mSimChains;
+  std::vector<std::vector<TChain*>> mThreadSimChains; // hit chains of the additional digitizers
   std::vector<o2::tpc::Digit> mDigits;
   o2::dataformats::MCTruthContainer<o2::MCCompLabel> mLabels;
   std::vector<o2::tpc::CommonMode> mCommonMode;
@@ -447,6 +646,7 @@ class TPCDPLDigitizerTask : public BaseDPLDigitizer
   size_t mFlushCounter = 0;
   int mLaneId = 0; // the id of the current process within the parallel pipeline
   int mSector = 0;
+  int mNThreads = 1; // number of threads to digitize the sectors concurrently
   bool mWriteGRP = false;
   bool mWithMCTruth = true;
   bool mInternalWriter = false;
@@ -485,7 +685,8 @@ o2::framework::DataProcessorSpec getTPCDigitizerSpec(int channel, bool writeGRP,
     Options{{"distortionType", VariantType::Int, 0, {"Distortion type to be used. 0 = no distortions (default), 1 = realistic distortions (not implemented yet), 2 = constant distortions"}},
             {"initialSpaceChargeDensity", VariantType::String, "", {"Path to root file containing TH3 with initial space-charge density and name of the TH3 (comma separated)"}},
             {"readSpaceCharge", VariantType::String, "", {"Path to root file containing pre-calculated space-charge object and name of the object (comma separated)"}},
-            {"TPCtriggered", VariantType::Bool, false, {"Impose triggered RO mode (default: continuous)"}}}};
+            {"TPCtriggered", VariantType::Bool, false, {"Impose triggered RO mode (default: continuous)"}},
+            {"nthreads", VariantType::Int, 1, {"Number of threads to digitize the sectors of a lane concurrently"}}}};
 }
 
 o2::framework::WorkflowSpec getTPCDigitizerSpec(int nLanes, std::vector<int> const& sectors, bool mctruth, bool internalwriter)
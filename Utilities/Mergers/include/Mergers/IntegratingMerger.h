@@ -24,6 +24,7 @@
 #include "Framework/Task.h"
 
 #include <memory>
+#include <vector>
 
 class TObject;
 
@@ -52,12 +53,14 @@ class IntegratingMerger : public framework::Task
   void run(framework::ProcessingContext& ctx) override;
 
  private:
+  void mergeDeltas(std::vector<ObjectStore>& deltas);
   void publish(framework::DataAllocator& allocator);
   void clear();
 
  private:
   header::DataHeader::SubSpecificationType mSubSpec;
   ObjectStore mMergedObject = std::monostate{};
+  std::vector<ObjectStore> mPendingDeltas; // deltas received, but not merged yet
   MergerConfig mConfig;
   std::unique_ptr<monitoring::Monitoring> mCollector;
   int mCyclesSinceReset = 0;
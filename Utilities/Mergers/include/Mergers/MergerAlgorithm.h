@@ -19,13 +19,29 @@
 
 #include "Mergers/MergeInterface.h"
 
+#include <vector>
+
 class TObject;
+class TAxis;
 
 namespace o2::mergers::algorithm
 {
 
 /// \brief A function which merges TObjects
 void merge(TObject* const target, TObject* const other);
+
+/// \brief Merges the others into the target without modifying them, using up to nThreads threads.
+/// Each thread sums a part of the objects into a clone of the first of them, the partial sums are merged at the end.
+void merge(TObject* const target, const std::vector<TObject*>& others, int nThreads);
+
+/// \brief Merges all the objects into the first one, pairwise in a binary tree, running up to nThreads merges at once.
+/// The other objects are modified too, so they should not be used afterwards.
+void mergeTree(const std::vector<TObject*>& objects, int nThreads);
+void mergeTree(const std::vector<MergeInterface*>& objects, int nThreads);
+
+/// \brief Returns true if the axes have the same number of bins and the same bin edges.
+bool haveSameBinning(const TAxis* a, const TAxis* b);
+
 void deleteTCollections(TObject* obj);
 
 } // namespace o2::mergers::algorithm
@@ -64,6 +64,7 @@ struct MergerConfig {
   ConfigEntry<PublicationDecision> publicationDecision = {PublicationDecision::EachNSeconds, 10};
   ConfigEntry<TopologySize, int> topologySize = {TopologySize::NumberOfLayers, 1};
   std::string monitoringUrl = "infologger:///debug?qc";
+  int mergingThreads = 1; // number of threads merging the objects, with more than one the deltas are buffered to be merged in parallel
 };
 
 } // namespace o2::mergers
@@ -0,0 +1,80 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+#ifndef O2_SPARSEHISTOGRAMDELTA_H
+#define O2_SPARSEHISTOGRAMDELTA_H
+
+/// \file SparseHistogramDelta.h
+/// \brief A histogram difference which is sent only with its filled bins, if there are few of them
+
+#include "Mergers/MergeInterface.h"
+
+#include <TObject.h>
+#include <TH1.h>
+
+#include <vector>
+
+namespace o2::mergers
+{
+
+/// \brief A histogram difference which is sent only with its filled bins, if there are few of them.
+///
+/// Producers which publish the differences of their histograms since the last publication (and reset them afterwards)
+/// can wrap them in SparseHistogramDelta to avoid sending the empty bins. If the share of filled bins is above
+/// maxFilledFraction, or if the histogram cannot be stored this way (e.g. profiles, labelled axes), the full histogram
+/// is kept instead. The binning is kept in a copy of the histogram without its bin arrays.
+/// Mergers merge these objects with each other, which yields a full histogram as soon as one of them is full or when
+/// the merged bins become too many. Use getHistogram() to access the result.
+class SparseHistogramDelta : public TObject, public MergeInterface
+{
+ public:
+  SparseHistogramDelta() = default;
+  /// \brief Copies the histogram, keeping only its filled bins if there are not more than maxFilledFraction of them.
+  SparseHistogramDelta(const TH1& histogram, double maxFilledFraction = 0.1);
+  ~SparseHistogramDelta() override;
+
+  SparseHistogramDelta(const SparseHistogramDelta&) = delete;
+  SparseHistogramDelta& operator=(const SparseHistogramDelta&) = delete;
+
+  void merge(MergeInterface* const other) override;
+
+  /// \brief Returns the full histogram, filling its bins first if only the filled ones are stored.
+  TH1* getHistogram();
+  bool isSparse() const { return mSparse; }
+  /// \brief Returns the number of stored bins, all the bins (incl. under- and overflows) if the histogram is full.
+  size_t getStoredBins() const;
+
+  const char* GetName() const override;
+
+ private:
+  bool canBeSparse(const TH1& histogram) const;
+  void sparsify();
+  void expand();
+  void addBinsTo(TH1* target) const;
+  void mergeSparse(const SparseHistogramDelta& other);
+
+  TH1* mHistogram = nullptr;          // the full histogram, or only its binning and properties if mSparse
+  bool mSparse = false;               // true if only the filled bins are stored
+  Double_t mMaxFilledFraction = 0.1;  // share of filled bins above which the histogram is stored in full
+  Int_t mNcells = 0;                  // number of bins of the full histogram, incl. under- and overflows
+  std::vector<Int_t> mBins;           // global numbers of the filled bins, in increasing order
+  std::vector<Double_t> mContents;    // contents of the filled bins
+  bool mHasSumw2 = false;             // true if the histogram has the sums of squares of weights
+  std::vector<Double_t> mSumw2;       // sums of squares of weights of the filled bins, if mHasSumw2
+  Double_t mStats[TH1::kNstat] = {0}; // statistics of the histogram, as given by TH1::GetStats()
+  Double_t mEntries = 0;              // number of entries of the histogram
+
+  ClassDefOverride(SparseHistogramDelta, 2);
+};
+
+} // namespace o2::mergers
+
+#endif //O2_SPARSEHISTOGRAMDELTA_H
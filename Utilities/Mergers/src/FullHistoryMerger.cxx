@@ -23,6 +23,7 @@
 #include "Framework/InputRecordWalker.h"
 #include "Framework/Logger.h"
 #include <Monitoring/MonitoringFactory.h>
+#include <TROOT.h>
 
 using namespace o2::header;
 using namespace o2::framework;
@@ -49,6 +50,9 @@ void FullHistoryMerger::init(framework::InitContext& ictx)
   mCyclesSinceReset = 0;
   mCollector = monitoring::MonitoringFactory::Get(mConfig.monitoringUrl);
   mCollector->addGlobalTag(monitoring::tags::Key::Subsystem, monitoring::tags::Value::Mergers);
+  if (mConfig.mergingThreads > 1) {
+    ROOT::EnableThreadSafety();
+  }
 }
 
 void FullHistoryMerger::run(framework::ProcessingContext& ctx)
@@ -132,13 +136,16 @@ void FullHistoryMerger::mergeCache()
   // We expect that all the objects use the same kind of interface
   if (std::holds_alternative<TObjectPtr>(mMergedObject)) {
 
+    // The cached objects are kept for the next cycles, so they are merged without being modified.
     auto target = std::get<TObjectPtr>(mMergedObject);
+    std::vector<TObject*> others;
+    others.reserve(mCache.size());
     for (auto& [name, entry] : mCache) {
       (void)name;
-      auto other = std::get<TObjectPtr>(entry);
-      algorithm::merge(target.get(), other.get());
-      mObjectsMerged++;
+      others.push_back(std::get<TObjectPtr>(entry).get());
     }
+    algorithm::merge(target.get(), others, mConfig.mergingThreads);
+    mObjectsMerged += others.size();
 
   } else if (std::holds_alternative<MergeInterfacePtr>(mMergedObject)) {
     auto target = std::get<MergeInterfacePtr>(mMergedObject);
@@ -20,6 +20,7 @@
 #include "Mergers/MergerBuilder.h"
 
 #include <Monitoring/MonitoringFactory.h>
+#include <TROOT.h>
 
 #include "Framework/InputRecordWalker.h"
 #include "Framework/Logger.h"
@@ -40,6 +41,9 @@ void IntegratingMerger::init(framework::InitContext& ictx)
   mCyclesSinceReset = 0;
   mCollector = monitoring::MonitoringFactory::Get(mConfig.monitoringUrl);
   mCollector->addGlobalTag(monitoring::tags::Key::Subsystem, monitoring::tags::Value::Mergers);
+  if (mConfig.mergingThreads > 1) {
+    ROOT::EnableThreadSafety();
+  }
 }
 
 void IntegratingMerger::run(framework::ProcessingContext& ctx)
@@ -49,27 +53,17 @@ void IntegratingMerger::run(framework::ProcessingContext& ctx)
 
   for (const DataRef& ref : InputRecordWalker(ctx.inputs())) {
     if (ref.header != timerHeader) {
-      auto other = object_store_helpers::extractObjectFrom(ref);
-      if (std::holds_alternative<std::monostate>(mMergedObject)) {
-        mMergedObject = std::move(object_store_helpers::extractObjectFrom(ref));
-      } else if (std::holds_alternative<TObjectPtr>(mMergedObject)) {
-        // We expect that if the first object was TObject, then all should.
-        auto targetAsTObject = std::get<TObjectPtr>(mMergedObject);
-        auto otherAsTObject = std::get<TObjectPtr>(other);
-        algorithm::merge(targetAsTObject.get(), otherAsTObject.get());
-
-      } else if (std::holds_alternative<MergeInterfacePtr>(mMergedObject)) {
-        // We expect that if the first object inherited MergeInterface, then all should.
-        auto otherAsMergeInterface = std::get<MergeInterfacePtr>(other);
-        std::get<MergeInterfacePtr>(mMergedObject)->merge(otherAsMergeInterface.get());
-      } else {
-        throw std::runtime_error("mMergedObject' variant has no value.");
-      }
-      mDeltasMerged++;
+      mPendingDeltas.push_back(object_store_helpers::extractObjectFrom(ref));
     }
   }
+  // Each run() usually sees a single delta, so with several merging threads the deltas are kept until
+  // there are enough of them to occupy all the threads in the first level of the merging tree.
+  if (mConfig.mergingThreads <= 1 || mPendingDeltas.size() >= static_cast<size_t>(2 * mConfig.mergingThreads)) {
+    mergeDeltas(mPendingDeltas);
+  }
 
   if (ctx.inputs().isValid("timer-publish")) {
+    mergeDeltas(mPendingDeltas);
     mCyclesSinceReset++;
     publish(ctx.outputs());
 
@@ -80,10 +74,45 @@ void IntegratingMerger::run(framework::ProcessingContext& ctx)
   }
 }
 
+void IntegratingMerger::mergeDeltas(std::vector<ObjectStore>& deltas)
+{
+  if (deltas.empty()) {
+    return;
+  }
+  size_t firstDelta = 0;
+  if (std::holds_alternative<std::monostate>(mMergedObject)) {
+    mMergedObject = std::move(deltas[0]);
+    firstDelta = 1;
+  }
+
+  // All the pending deltas are merged together with the merged object in a binary tree,
+  // so that independent pairs can be merged in parallel. The deltas are discarded afterwards.
+  if (std::holds_alternative<TObjectPtr>(mMergedObject)) {
+    // We expect that if the first object was TObject, then all should.
+    std::vector<TObject*> objects{std::get<TObjectPtr>(mMergedObject).get()};
+    for (size_t i = firstDelta; i < deltas.size(); i++) {
+      objects.push_back(std::get<TObjectPtr>(deltas[i]).get());
+    }
+    algorithm::mergeTree(objects, mConfig.mergingThreads);
+  } else if (std::holds_alternative<MergeInterfacePtr>(mMergedObject)) {
+    // We expect that if the first object inherited MergeInterface, then all should.
+    std::vector<MergeInterface*> objects{std::get<MergeInterfacePtr>(mMergedObject).get()};
+    for (size_t i = firstDelta; i < deltas.size(); i++) {
+      objects.push_back(std::get<MergeInterfacePtr>(deltas[i]).get());
+    }
+    algorithm::mergeTree(objects, mConfig.mergingThreads);
+  } else {
+    throw std::runtime_error("mMergedObject' variant has no value.");
+  }
+  mDeltasMerged += deltas.size();
+  deltas.clear();
+}
+
 // I am not calling it reset(), because it does not have to be performed during the FairMQs reset.
 void IntegratingMerger::clear()
 {
   mMergedObject = std::monostate{};
+  mPendingDeltas.clear();
   mCyclesSinceReset = 0;
   mTotalDeltasMerged = 0;
   mDeltasMerged = 0;
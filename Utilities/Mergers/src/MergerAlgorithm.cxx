@@ -27,9 +27,174 @@
 #include <TObjArray.h>
 #include <TGraph.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+
 namespace o2::mergers::algorithm
 {
 
+namespace
+{
+
+// Adds the bin contents of `other` to `target`, saturating the integer counters as TH1::AddBinContent() does.
+template <typename A>
+void addBinArrays(TH1* target, TH1* other)
+{
+  auto* targetArray = dynamic_cast<A*>(target);
+  auto* otherArray = dynamic_cast<A*>(other);
+  using value_t = std::remove_pointer_t<decltype(targetArray->fArray)>;
+  for (Int_t i = 0; i < targetArray->fN; ++i) {
+    if constexpr (std::is_integral_v<value_t>) {
+      constexpr Long64_t limit = std::numeric_limits<value_t>::max();
+      targetArray->fArray[i] = std::clamp(Long64_t(targetArray->fArray[i]) + otherArray->fArray[i], -limit, limit);
+    } else {
+      targetArray->fArray[i] += otherArray->fArray[i];
+    }
+  }
+}
+
+using BinArraysAdder = void (*)(TH1*, TH1*);
+
+// Only the plain histogram classes are summed directly, derived classes (e.g. profiles) can hold more than bin contents.
+BinArraysAdder getBinArraysAdder(const TH1* hist)
+{
+  auto* cl = hist->IsA();
+  if (cl == TH1D::Class() || cl == TH2D::Class() || cl == TH3D::Class()) {
+    return addBinArrays<TArrayD>;
+  } else if (cl == TH1F::Class() || cl == TH2F::Class() || cl == TH3F::Class()) {
+    return addBinArrays<TArrayF>;
+  } else if (cl == TH1I::Class() || cl == TH2I::Class() || cl == TH3I::Class()) {
+    return addBinArrays<TArrayI>;
+  } else if (cl == TH1S::Class() || cl == TH2S::Class() || cl == TH3S::Class()) {
+    return addBinArrays<TArrayS>;
+  } else if (cl == TH1C::Class() || cl == TH2C::Class() || cl == TH3C::Class()) {
+    return addBinArrays<TArrayC>;
+  }
+  return nullptr;
+}
+
+bool canAddBinArrays(const TAxis* a, const TAxis* b)
+{
+  // labelled bins are matched by their labels by TH1::Merge()
+  if (a->GetLabels() != nullptr || b->GetLabels() != nullptr) {
+    return false;
+  }
+  // the statistics of histograms with a restricted axis range do not cover all the bins
+  if (a->TestBit(TAxis::kAxisRange) || b->TestBit(TAxis::kAxisRange)) {
+    return false;
+  }
+  return haveSameBinning(a, b);
+}
+
+// A fast path for the most common case: histograms of the same class and with the same binning are summed directly
+// on their bin arrays, avoiding the generic TH1::Merge() machinery. Returns false if it does not apply.
+bool mergeSameBinning(TH1* target, TH1* other)
+{
+  if (target->IsA() != other->IsA() || target->GetBuffer() != nullptr || other->GetBuffer() != nullptr) {
+    return false;
+  }
+  BinArraysAdder addBinContents = getBinArraysAdder(target);
+  if (addBinContents == nullptr) {
+    return false;
+  }
+  if (!canAddBinArrays(target->GetXaxis(), other->GetXaxis()) ||
+      !canAddBinArrays(target->GetYaxis(), other->GetYaxis()) ||
+      !canAddBinArrays(target->GetZaxis(), other->GetZaxis())) {
+    return false;
+  }
+
+  // the statistics have to be taken before the bin contents change
+  Double_t targetStats[TH1::kNstat] = {0};
+  Double_t otherStats[TH1::kNstat] = {0};
+  target->GetStats(targetStats);
+  other->GetStats(otherStats);
+  Double_t entries = target->GetEntries() + other->GetEntries();
+
+  bool otherHasSumw2 = other->GetSumw2N() > 0;
+  if (otherHasSumw2 && target->GetSumw2N() == 0) {
+    target->Sumw2();
+  }
+  addBinContents(target, other);
+  if (target->GetSumw2N() > 0) {
+    Double_t* targetSumw2 = target->GetSumw2()->GetArray();
+    if (otherHasSumw2) {
+      const Double_t* otherSumw2 = other->GetSumw2()->GetArray();
+      for (Int_t i = 0; i < target->GetSumw2N(); ++i) {
+        targetSumw2[i] += otherSumw2[i];
+      }
+    } else {
+      for (Int_t i = 0; i < target->GetSumw2N(); ++i) {
+        targetSumw2[i] += std::abs(other->GetBinContent(i));
+      }
+    }
+  }
+
+  for (int i = 0; i < TH1::kNstat; ++i) {
+    targetStats[i] += otherStats[i];
+  }
+  target->PutStats(targetStats);
+  target->SetEntries(entries);
+  return true;
+}
+
+// Runs the calls of `function` for indices from 0 to n - 1 on up to nThreads threads and rethrows the first exception.
+template <typename F>
+void parallelFor(size_t n, int nThreads, F function)
+{
+  std::atomic<size_t> next{0};
+  size_t nWorkers = std::min<size_t>(std::max(nThreads, 1), n);
+  std::vector<std::exception_ptr> errors(nWorkers);
+  auto worker = [&](size_t workerId) {
+    try {
+      for (size_t i = next++; i < n; i = next++) {
+        function(i);
+      }
+    } catch (...) {
+      errors[workerId] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t workerId = 1; workerId < nWorkers; ++workerId) {
+    threads.emplace_back(worker, workerId);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+template <typename T, typename M>
+void mergeTreeImpl(const std::vector<T*>& objects, int nThreads, M mergeFunction)
+{
+  if (nThreads <= 1) {
+    for (size_t i = 1; i < objects.size(); ++i) {
+      mergeFunction(objects[0], objects[i]);
+    }
+    return;
+  }
+  // at each level the object at i absorbs the one at i + stride, all these merges are independent
+  for (size_t stride = 1; stride < objects.size(); stride *= 2) {
+    size_t nPairs = (objects.size() - 1 + stride) / (2 * stride);
+    parallelFor(nPairs, nThreads, [&](size_t pair) {
+      mergeFunction(objects[2 * stride * pair], objects[2 * stride * pair + stride]);
+    });
+  }
+}
+
+} // namespace
+
 void merge(TObject* const target, TObject* const other)
 {
   if (target == nullptr) {
@@ -57,15 +222,26 @@ void merge(TObject* const target, TObject* const other)
                                "' is a TCollection, while the other object '" + other->GetName() + "' is not.");
     }
 
+    // We index the target collection by names once, instead of searching it for each object with FindObject().
+    // The first object with a given name is kept, as FindObject() would return it.
+    std::unordered_map<std::string, TObject*> targetObjects;
+    auto targetIterator = targetCollection->MakeIterator();
+    while (auto targetObject = targetIterator->Next()) {
+      targetObjects.emplace(targetObject->GetName(), targetObject);
+    }
+    delete targetIterator;
+
     auto otherIterator = otherCollection->MakeIterator();
     while (auto otherObject = otherIterator->Next()) {
-      TObject* targetObject = targetCollection->FindObject(otherObject->GetName());
-      if (targetObject) {
+      auto targetObject = targetObjects.find(otherObject->GetName());
+      if (targetObject != targetObjects.end()) {
         // That might be another collection or a concrete object to be merged, we walk on the collection recursively.
-        merge(targetObject, otherObject);
+        merge(targetObject->second, otherObject);
       } else {
         // We prefer to clone instead of passing the pointer in order to simplify deleting the `other`.
-        targetCollection->Add(otherObject->Clone());
+        auto clone = otherObject->Clone();
+        targetCollection->Add(clone);
+        targetObjects.emplace(clone->GetName(), clone);
       }
     }
     delete otherIterator;
@@ -75,7 +251,10 @@ void merge(TObject* const target, TObject* const other)
     otherCollection.SetOwner(false);
     otherCollection.Add(other);
 
-    if (target->InheritsFrom(TH1::Class())) {
+    if (target->InheritsFrom(TH1::Class()) && other->InheritsFrom(TH1::Class()) &&
+        mergeSameBinning(static_cast<TH1*>(target), static_cast<TH1*>(other))) {
+      // histograms with the same binning were summed directly
+    } else if (target->InheritsFrom(TH1::Class())) {
       // this includes TH1, TH2, TH3
       errorCode = reinterpret_cast<TH1*>(target)->Merge(&otherCollection);
     } else if (target->InheritsFrom(THnBase::Class())) {
@@ -94,6 +273,60 @@ void merge(TObject* const target, TObject* const other)
   }
 }
 
+void merge(TObject* const target, const std::vector<TObject*>& others, int nThreads)
+{
+  size_t nParts = std::min<size_t>(std::max(nThreads, 1), others.size());
+  if (nParts <= 1) {
+    for (auto other : others) {
+      merge(target, other);
+    }
+    return;
+  }
+
+  // The first part is merged into the target directly, the others into clones of their first object.
+  // The clones are made upfront in this thread, as ROOT may register them in the current directory.
+  std::vector<TObject*> partialSums{target};
+  std::vector<size_t> partBegins{0};
+  for (size_t part = 1; part < nParts; ++part) {
+    partBegins.push_back(others.size() * part / nParts);
+    partialSums.push_back(others[partBegins.back()]->Clone());
+  }
+  partBegins.push_back(others.size());
+
+  try {
+    parallelFor(nParts, nThreads, [&](size_t part) {
+      for (size_t i = partBegins[part] + (part == 0 ? 0 : 1); i < partBegins[part + 1]; ++i) {
+        merge(partialSums[part], others[i]);
+      }
+    });
+    mergeTree(partialSums, nThreads);
+  } catch (...) {
+    std::for_each(partialSums.begin() + 1, partialSums.end(), deleteTCollections);
+    throw;
+  }
+  std::for_each(partialSums.begin() + 1, partialSums.end(), deleteTCollections);
+}
+
+void mergeTree(const std::vector<TObject*>& objects, int nThreads)
+{
+  mergeTreeImpl(objects, nThreads, [](TObject* target, TObject* other) { merge(target, other); });
+}
+
+void mergeTree(const std::vector<MergeInterface*>& objects, int nThreads)
+{
+  mergeTreeImpl(objects, nThreads, [](MergeInterface* target, MergeInterface* other) { target->merge(other); });
+}
+
+bool haveSameBinning(const TAxis* a, const TAxis* b)
+{
+  if (a->GetNbins() != b->GetNbins() || a->GetXmin() != b->GetXmin() || a->GetXmax() != b->GetXmax()) {
+    return false;
+  }
+  const TArrayD* aEdges = a->GetXbins();
+  const TArrayD* bEdges = b->GetXbins();
+  return aEdges->fN == bEdges->fN && std::equal(aEdges->fArray, aEdges->fArray + aEdges->fN, bEdges->fArray);
+}
+
 void deleteTCollections(TObject* obj)
 {
   if (auto c = dynamic_cast<TCollection*>(obj)) {
@@ -0,0 +1,247 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file SparseHistogramDelta.cxx
+/// \brief Implementation of SparseHistogramDelta
+
+#include "Mergers/SparseHistogramDelta.h"
+#include "Mergers/MergerAlgorithm.h"
+
+#include <TH2.h>
+#include <TH3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace o2::mergers
+{
+
+namespace
+{
+
+// The bins are added by their global numbers, which match only if all the axes are the same.
+void checkSameBinning(const TH1* a, const TH1* b)
+{
+  if (a->IsA() != b->IsA() ||
+      !algorithm::haveSameBinning(a->GetXaxis(), b->GetXaxis()) ||
+      !algorithm::haveSameBinning(a->GetYaxis(), b->GetYaxis()) ||
+      !algorithm::haveSameBinning(a->GetZaxis(), b->GetZaxis())) {
+    throw std::runtime_error(std::string("The histogram '") + a->GetName() + "' does not have the same type and binning as '" +
+                             b->GetName() + "'");
+  }
+}
+
+} // namespace
+
+SparseHistogramDelta::SparseHistogramDelta(const TH1& histogram, double maxFilledFraction)
+  : TObject(), MergeInterface(), mMaxFilledFraction(maxFilledFraction)
+{
+  mHistogram = static_cast<TH1*>(histogram.Clone());
+  mHistogram->SetDirectory(nullptr);
+  mHistogram->BufferEmpty();
+  mNcells = mHistogram->GetNcells();
+  if (canBeSparse(*mHistogram)) {
+    sparsify();
+  }
+}
+
+SparseHistogramDelta::~SparseHistogramDelta()
+{
+  delete mHistogram;
+}
+
+const char* SparseHistogramDelta::GetName() const
+{
+  return mHistogram ? mHistogram->GetName() : "";
+}
+
+size_t SparseHistogramDelta::getStoredBins() const
+{
+  return mSparse ? mBins.size() : mNcells;
+}
+
+bool SparseHistogramDelta::canBeSparse(const TH1& histogram) const
+{
+  // Only the plain histogram classes are fully described by their bin contents, sumw2 and statistics.
+  auto* cl = histogram.IsA();
+  bool plainClass = cl == TH1D::Class() || cl == TH1F::Class() || cl == TH1I::Class() || cl == TH1S::Class() || cl == TH1C::Class() ||
+                    cl == TH2D::Class() || cl == TH2F::Class() || cl == TH2I::Class() || cl == TH2S::Class() || cl == TH2C::Class() ||
+                    cl == TH3D::Class() || cl == TH3F::Class() || cl == TH3I::Class() || cl == TH3S::Class() || cl == TH3C::Class();
+  // labelled bins could be reordered when merged with full histograms
+  bool labelled = histogram.GetXaxis()->GetLabels() || histogram.GetYaxis()->GetLabels() || histogram.GetZaxis()->GetLabels();
+  return plainClass && !labelled;
+}
+
+void SparseHistogramDelta::sparsify()
+{
+  bool withSumw2 = mHistogram->GetSumw2N() > 0;
+  const Double_t* sumw2 = withSumw2 ? mHistogram->GetSumw2()->GetArray() : nullptr;
+
+  auto maxBins = static_cast<size_t>(mMaxFilledFraction * mNcells);
+  std::vector<Int_t> bins;
+  for (Int_t bin = 0; bin < mNcells; bin++) {
+    // a bin filled with opposite weights has no content, but it has the sum of their squares
+    if (mHistogram->GetBinContent(bin) != 0 || (withSumw2 && sumw2[bin] != 0)) {
+      if (bins.size() == maxBins) {
+        return;
+      }
+      bins.push_back(bin);
+    }
+  }
+
+  mBins = std::move(bins);
+  mHasSumw2 = withSumw2;
+  mContents.resize(mBins.size());
+  mSumw2.resize(withSumw2 ? mBins.size() : 0);
+  for (size_t i = 0; i < mBins.size(); i++) {
+    mContents[i] = mHistogram->GetBinContent(mBins[i]);
+    if (withSumw2) {
+      mSumw2[i] = sumw2[mBins[i]];
+    }
+  }
+  mHistogram->GetStats(mStats);
+  mEntries = mHistogram->GetEntries();
+
+  // the histogram is kept only for its binning and properties, thus its bin arrays are dropped
+  mHistogram->SetBinsLength(0);
+  mHistogram->GetSumw2()->Set(0);
+  mSparse = true;
+}
+
+void SparseHistogramDelta::expand()
+{
+  if (!mSparse) {
+    return;
+  }
+  mHistogram->SetBinsLength(mNcells);
+  if (mHasSumw2) {
+    mHistogram->GetSumw2()->Set(mNcells);
+  }
+  mSparse = false;
+  // the histogram is empty, so adding the stored bins restores it
+  Double_t noStats[TH1::kNstat] = {0};
+  mHistogram->PutStats(noStats);
+  mHistogram->SetEntries(0);
+  addBinsTo(mHistogram);
+
+  mBins.clear();
+  mContents.clear();
+  mSumw2.clear();
+}
+
+TH1* SparseHistogramDelta::getHistogram()
+{
+  expand();
+  return mHistogram;
+}
+
+void SparseHistogramDelta::addBinsTo(TH1* target) const
+{
+  checkSameBinning(target, mHistogram);
+
+  // the statistics have to be taken before the bin contents change
+  Double_t stats[TH1::kNstat] = {0};
+  target->GetStats(stats);
+  Double_t entries = target->GetEntries() + mEntries;
+
+  if (mHasSumw2 && target->GetSumw2N() == 0) {
+    target->Sumw2();
+  }
+  for (size_t i = 0; i < mBins.size(); i++) {
+    target->SetBinContent(mBins[i], target->GetBinContent(mBins[i]) + mContents[i]);
+  }
+  if (target->GetSumw2N() > 0) {
+    Double_t* sumw2 = target->GetSumw2()->GetArray();
+    for (size_t i = 0; i < mBins.size(); i++) {
+      sumw2[mBins[i]] += mHasSumw2 ? mSumw2[i] : std::abs(mContents[i]);
+    }
+  }
+
+  for (int i = 0; i < TH1::kNstat; i++) {
+    stats[i] += mStats[i];
+  }
+  target->PutStats(stats);
+  target->SetEntries(entries);
+}
+
+void SparseHistogramDelta::mergeSparse(const SparseHistogramDelta& other)
+{
+  checkSameBinning(other.mHistogram, mHistogram);
+
+  // both lists of bins are sorted, so they are merged in one pass
+  bool withSumw2 = mHasSumw2 || other.mHasSumw2;
+  auto sumw2Of = [](const SparseHistogramDelta& delta, size_t i) {
+    return delta.mHasSumw2 ? delta.mSumw2[i] : std::abs(delta.mContents[i]);
+  };
+  std::vector<Int_t> bins;
+  std::vector<Double_t> contents;
+  std::vector<Double_t> sumw2;
+  bins.reserve(mBins.size() + other.mBins.size());
+  contents.reserve(mBins.size() + other.mBins.size());
+  sumw2.reserve(withSumw2 ? mBins.size() + other.mBins.size() : 0);
+  size_t i = 0, j = 0;
+  while (i < mBins.size() || j < other.mBins.size()) {
+    bool fromThis = j == other.mBins.size() || (i < mBins.size() && mBins[i] <= other.mBins[j]);
+    bool fromOther = i == mBins.size() || (j < other.mBins.size() && other.mBins[j] <= mBins[i]);
+    bins.push_back(fromThis ? mBins[i] : other.mBins[j]);
+    contents.push_back((fromThis ? mContents[i] : 0.) + (fromOther ? other.mContents[j] : 0.));
+    if (withSumw2) {
+      sumw2.push_back((fromThis ? sumw2Of(*this, i) : 0.) + (fromOther ? sumw2Of(other, j) : 0.));
+    }
+    i += fromThis;
+    j += fromOther;
+  }
+  mBins = std::move(bins);
+  mContents = std::move(contents);
+  mSumw2 = std::move(sumw2);
+  mHasSumw2 = withSumw2;
+
+  for (int k = 0; k < TH1::kNstat; k++) {
+    mStats[k] += other.mStats[k];
+  }
+  mEntries += other.mEntries;
+
+  if (mBins.size() > mMaxFilledFraction * mNcells) {
+    expand();
+  }
+}
+
+void SparseHistogramDelta::merge(MergeInterface* const other)
+{
+  auto* otherDelta = dynamic_cast<SparseHistogramDelta*>(other);
+  if (otherDelta == nullptr) {
+    throw std::runtime_error("SparseHistogramDelta can be merged only with another SparseHistogramDelta");
+  }
+
+  if (!mSparse && !otherDelta->mSparse) {
+    algorithm::merge(mHistogram, otherDelta->mHistogram);
+  } else if (!mSparse) {
+    otherDelta->addBinsTo(mHistogram);
+  } else if (!otherDelta->mSparse) {
+    // we take a copy of the other full histogram and add our bins to it, the other object is not modified
+    checkSameBinning(otherDelta->mHistogram, mHistogram);
+    auto* full = static_cast<TH1*>(otherDelta->mHistogram->Clone());
+    full->SetDirectory(nullptr);
+    addBinsTo(full);
+    delete mHistogram;
+    mHistogram = full;
+    mSparse = false;
+    mBins.clear();
+    mContents.clear();
+    mSumw2.clear();
+  } else {
+    mergeSparse(*otherDelta);
+  }
+}
+
+} // namespace o2::mergers
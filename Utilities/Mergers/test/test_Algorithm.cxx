@@ -36,6 +36,8 @@
 #include <TGraph.h>
 #include <TProfile.h>
 
+#include <vector>
+
 //using namespace o2::framework;
 using namespace o2::mergers;
 
@@ -300,6 +302,48 @@ BOOST_AUTO_TEST_CASE(MergerCollection)
   delete target;
 }
 
+BOOST_AUTO_TEST_CASE(MergerHistogramsInParallel)
+{
+  // The reference is merged with TH1::Merge(), the target with the direct sum of the bins in several threads.
+  TH2F* reference = new TH2F("reference", "reference", bins, min, max, bins, min, max);
+  TH2F* target = new TH2F("obj", "obj", bins, min, max, bins, min, max);
+  target->Fill(5, 5, 0.5);
+  reference->Fill(5, 5, 0.5);
+
+  std::vector<TObject*> others;
+  TList referenceOthers;
+  for (size_t i = 0; i < 20; i++) {
+    TH2F* other = new TH2F("obj", "obj", bins, min, max, bins, min, max);
+    other->Fill(i % max, 2, 2.0);
+    other->Fill(-1, max + 1);
+    others.push_back(other);
+    referenceOthers.Add(other);
+  }
+  reference->Merge(&referenceOthers);
+
+  BOOST_CHECK_NO_THROW(algorithm::merge(target, others, 4));
+  BOOST_CHECK_EQUAL(target->GetEntries(), reference->GetEntries());
+  BOOST_CHECK_CLOSE(target->GetMean(1), reference->GetMean(1), 1e-6);
+  BOOST_CHECK_CLOSE(target->GetStdDev(2), reference->GetStdDev(2), 1e-6);
+  for (Int_t bin = 0; bin < target->GetNcells(); bin++) {
+    BOOST_CHECK_EQUAL(target->GetBinContent(bin), reference->GetBinContent(bin));
+    BOOST_CHECK_EQUAL(target->GetBinError(bin), reference->GetBinError(bin));
+  }
+  // the others should stay untouched
+  BOOST_CHECK_EQUAL(static_cast<TH2F*>(others[0])->GetEntries(), 2);
+
+  // merging in a tree modifies all the objects, but the first one contains the sum
+  BOOST_CHECK_NO_THROW(algorithm::mergeTree(others, 3));
+  BOOST_CHECK_EQUAL(static_cast<TH2F*>(others[0])->GetEntries(), 40);
+  BOOST_CHECK_EQUAL(static_cast<TH2F*>(others[0])->GetBinContent(target->FindBin(-1, max + 1)), 20);
+
+  for (auto other : others) {
+    delete other;
+  }
+  delete target;
+  delete reference;
+}
+
 BOOST_AUTO_TEST_CASE(Deleting)
 {
   TObjArray* main = new TObjArray();
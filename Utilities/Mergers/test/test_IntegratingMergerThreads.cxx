@@ -0,0 +1,105 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file    test_IntegratingMergerThreads.cxx
+/// \brief   A workflow test of the IntegratingMerger with several merging threads
+///
+/// The producer sends one delta per timeframe, so that each run() of the merger sees a single delta.
+/// The merger has to buffer them to merge them in parallel and the merged object must contain all of them.
+
+#include "Framework/RootSerializationSupport.h"
+#include "Mergers/MergerBuilder.h"
+
+#include <Framework/CompletionPolicy.h>
+
+using namespace o2::framework;
+using namespace o2::mergers;
+
+void customize(std::vector<CompletionPolicy>& policies)
+{
+  MergerBuilder::customizeInfrastructure(policies);
+}
+
+#include "Framework/runDataProcessing.h"
+#include "Framework/ControlService.h"
+#include "Framework/Logger.h"
+#include "Mergers/MergerInfrastructureBuilder.h"
+
+#include <TH1F.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#define ASSERT_ERROR(condition)                                   \
+  if ((condition) == false) {                                     \
+    LOG(FATAL) << R"(Test condition ")" #condition R"(" failed)"; \
+  }
+
+// not a multiple of twice the number of threads, so that some deltas are merged only at the publication
+constexpr int NDeltas = 21;
+constexpr int NMergingThreads = 4;
+
+WorkflowSpec defineDataProcessing(ConfigContext const&)
+{
+  WorkflowSpec specs;
+
+  DataProcessorSpec producer{
+    "producer",
+    Inputs{},
+    Outputs{{{"mo"}, "TST", "HISTO", 1, Lifetime::Timeframe}},
+    AlgorithmSpec{(AlgorithmSpec::InitCallback)[](InitContext&) {
+      auto sent = std::make_shared<int>(0);
+      return (AlgorithmSpec::ProcessCallback)[sent](ProcessingContext & pc) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (*sent >= NDeltas) {
+          return;
+        }
+        auto& histo = pc.outputs().make<TH1F>(Output{"TST", "HISTO", 1}, "histo", "histo", NDeltas, 0, NDeltas);
+        histo.Fill(*sent);
+        (*sent)++;
+      };
+    }}};
+  specs.push_back(producer);
+
+  MergerInfrastructureBuilder mergersBuilder;
+  mergersBuilder.setInfrastructureName("histos");
+  mergersBuilder.setInputSpecs({{"mo", "TST", "HISTO", 1, Lifetime::Timeframe}});
+  mergersBuilder.setOutputSpec({{"main"}, "TST", "HISTO", 0});
+  MergerConfig config;
+  config.inputObjectTimespan = {InputObjectsTimespan::LastDifference};
+  config.publicationDecision = {PublicationDecision::EachNSeconds, 1};
+  config.mergedObjectTimespan = {MergedObjectTimespan::FullHistory};
+  config.topologySize = {TopologySize::NumberOfLayers, 1};
+  config.monitoringUrl = "no-op://";
+  config.mergingThreads = NMergingThreads;
+  mergersBuilder.setConfig(config);
+  mergersBuilder.generateInfrastructure(specs);
+
+  DataProcessorSpec checker{
+    "checker",
+    Inputs{{"histo", "TST", "HISTO", 0}},
+    Outputs{},
+    AlgorithmSpec{[](ProcessingContext& pc) {
+      auto histo = pc.inputs().get<TH1F*>("histo");
+      LOG(INFO) << "Received the merged object with " << histo->GetEntries() << " entries";
+      ASSERT_ERROR(histo->GetEntries() <= NDeltas);
+      if (histo->GetEntries() < NDeltas) {
+        return; // wait for the next publication
+      }
+      for (int bin = 1; bin <= NDeltas; bin++) {
+        ASSERT_ERROR(histo->GetBinContent(bin) == 1);
+      }
+      pc.services().get<ControlService>().readyToQuit(QuitRequest::All);
+    }}};
+  specs.push_back(checker);
+
+  return specs;
+}
@@ -0,0 +1,200 @@
+// Copyright 2019-2020 CERN and copyright holders of ALICE O2.
+// See https://alice-o2.web.cern.ch/copyright for details of the copyright holders.
+// All rights not expressly granted are reserved.
+//
+// This software is distributed under the terms of the GNU General Public
+// License v3 (GPL Version 3), copied verbatim in the file "COPYING".
+//
+// In applying this license CERN does not waive the privileges and immunities
+// granted to it by virtue of its status as an Intergovernmental Organization
+// or submit itself to any jurisdiction.
+
+/// \file test_SparseHistogramDelta.cxx
+/// \brief A unit test of SparseHistogramDelta
+
+#define BOOST_TEST_MODULE Test Utilities MergerSparseHistogramDelta
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+
+#include "Mergers/SparseHistogramDelta.h"
+#include "Mergers/MergerAlgorithm.h"
+#include "Mergers/ObjectStore.h"
+#include "Headers/DataHeader.h"
+#include "Framework/DataRef.h"
+
+#include <TH1.h>
+#include <TH2.h>
+#include <TList.h>
+#include <TMessage.h>
+#include <TProfile.h>
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace o2::framework;
+using namespace o2::mergers;
+
+const size_t bins = 100;
+const size_t min = 0;
+const size_t max = 100;
+
+void checkSameHistograms(TH1* result, TH1* reference)
+{
+  BOOST_REQUIRE_EQUAL(result->GetNcells(), reference->GetNcells());
+  BOOST_CHECK_EQUAL(result->GetEntries(), reference->GetEntries());
+  BOOST_CHECK_CLOSE(result->GetMean(1), reference->GetMean(1), 1e-6);
+  BOOST_CHECK_CLOSE(result->GetStdDev(2), reference->GetStdDev(2), 1e-6);
+  for (Int_t bin = 0; bin < result->GetNcells(); bin++) {
+    BOOST_CHECK_EQUAL(result->GetBinContent(bin), reference->GetBinContent(bin));
+    BOOST_CHECK_EQUAL(result->GetBinError(bin), reference->GetBinError(bin));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SparseHistogramDeltaEncoding)
+{
+  TH2F histogram("histo", "histo", bins, min, max, bins, min, max);
+  histogram.Fill(5, 5);
+  histogram.Fill(50, 20, 2.0);
+  histogram.Fill(-1, 200);
+
+  SparseHistogramDelta sparse(histogram);
+  BOOST_CHECK(sparse.isSparse());
+  BOOST_CHECK_EQUAL(sparse.getStoredBins(), 3);
+  BOOST_CHECK_EQUAL(sparse.GetName(), "histo");
+  checkSameHistograms(sparse.getHistogram(), &histogram);
+  BOOST_CHECK(!sparse.isSparse());
+
+  // too many filled bins
+  for (size_t i = 0; i < bins; i++) {
+    histogram.Fill(i, i);
+  }
+  SparseHistogramDelta full(histogram, 0.001);
+  BOOST_CHECK(!full.isSparse());
+  checkSameHistograms(full.getHistogram(), &histogram);
+
+  // not supported
+  TProfile profile("profile", "profile", bins, min, max);
+  profile.Fill(5, 5);
+  SparseHistogramDelta fullProfile(profile);
+  BOOST_CHECK(!fullProfile.isSparse());
+}
+
+BOOST_AUTO_TEST_CASE(SparseHistogramDeltaMerging)
+{
+  // the reference is merged with TH1::Merge(), the deltas by themselves
+  TH2F* reference = new TH2F("histo", "histo", bins, min, max, bins, min, max);
+  TList others;
+  others.SetOwner(true);
+  std::vector<std::unique_ptr<SparseHistogramDelta>> deltas;
+  for (size_t i = 0; i < 8; i++) {
+    TH2F* histogram = new TH2F("histo", "histo", bins, min, max, bins, min, max);
+    histogram->Fill(i, 2 * i, 0.5);
+    histogram->Fill(10, 20);
+    // every third one is filled too much to be sparse
+    if (i % 3 == 0) {
+      for (size_t j = 0; j < bins; j++) {
+        histogram->Fill(j, j, 2.0);
+      }
+    }
+    deltas.emplace_back(new SparseHistogramDelta(*histogram, 0.005));
+    BOOST_CHECK_EQUAL(deltas.back()->isSparse(), i % 3 != 0);
+    others.Add(histogram);
+  }
+  reference->Merge(&others);
+
+  // sparse + sparse, sparse + full, full + sparse and full + full
+  std::vector<MergeInterface*> objects{deltas[1].get(), deltas[2].get(), deltas[4].get(), deltas[0].get(),
+                                       deltas[3].get(), deltas[5].get(), deltas[6].get(), deltas[7].get()};
+  BOOST_CHECK_NO_THROW(algorithm::mergeTree(objects, 1));
+  checkSameHistograms(deltas[1]->getHistogram(), reference);
+
+  delete reference;
+}
+
+BOOST_AUTO_TEST_CASE(SparseHistogramDeltaEmptyWithSumw2)
+{
+  // nothing filled, the sums of squares of weights must be kept nevertheless
+  TH1F empty("histo", "histo", bins, min, max);
+  empty.Sumw2();
+  SparseHistogramDelta emptyDelta(empty);
+  BOOST_CHECK(emptyDelta.isSparse());
+  BOOST_CHECK_EQUAL(emptyDelta.getStoredBins(), 0);
+  BOOST_CHECK_NE(emptyDelta.getHistogram()->GetSumw2N(), 0);
+
+  // and used when merged with a delta without them
+  TH1F weighted("histo", "histo", bins, min, max);
+  weighted.Sumw2();
+  TH1F unweighted("histo", "histo", bins, min, max);
+  unweighted.Fill(5, 3.0);
+  TH1F reference("histo", "histo", bins, min, max);
+  reference.Sumw2();
+  reference.Add(&unweighted);
+  SparseHistogramDelta weightedDelta(weighted);
+  SparseHistogramDelta unweightedDelta(unweighted);
+  weightedDelta.merge(&unweightedDelta);
+  checkSameHistograms(weightedDelta.getHistogram(), &reference);
+}
+
+BOOST_AUTO_TEST_CASE(SparseHistogramDeltaDifferentBinning)
+{
+  auto check = [](const TH1& a, const TH1& b) {
+    // sparse + sparse, full + sparse and sparse + full
+    for (auto [aFraction, bFraction] : {std::pair{1., 1.}, std::pair{0., 1.}, std::pair{1., 0.}}) {
+      SparseHistogramDelta aDelta(a, aFraction);
+      SparseHistogramDelta bDelta(b, bFraction);
+      BOOST_CHECK_THROW(aDelta.merge(&bDelta), std::runtime_error);
+    }
+  };
+
+  // the same number of bins, but different axes
+  TH2F histo10x20("histo", "histo", 10, 0, 10, 20, 0, 20);
+  TH2F histo20x10("histo", "histo", 20, 0, 20, 10, 0, 10);
+  histo10x20.Fill(1, 1);
+  histo20x10.Fill(1, 1);
+  check(histo10x20, histo20x10);
+
+  TH1F histoTo100("histo", "histo", 100, 0, 100);
+  TH1F histoTo200("histo", "histo", 100, 0, 200);
+  histoTo100.Fill(1);
+  histoTo200.Fill(1);
+  check(histoTo100, histoTo200);
+
+  const Double_t edges[] = {0, 1, 2, 4, 8, 16};
+  TH1F histoVariable("histo", "histo", 5, edges);
+  TH1F histoFixed("histo", "histo", 5, 0, 16);
+  histoVariable.Fill(1);
+  histoFixed.Fill(1);
+  check(histoVariable, histoFixed);
+}
+
+BOOST_AUTO_TEST_CASE(SparseHistogramDeltaSerialization)
+{
+  TH1I histogram("histo", "histo", bins, min, max);
+  histogram.Fill(5);
+  histogram.Fill(5);
+  histogram.Fill(500);
+
+  SparseHistogramDelta sparse(histogram);
+  BOOST_REQUIRE(sparse.isSparse());
+
+  // the way a merger receives it
+  TMessage message(kMESS_OBJECT);
+  message.WriteObject(&sparse);
+  o2::header::DataHeader dh;
+  dh.payloadSerializationMethod = o2::header::gSerializationMethodROOT;
+  dh.payloadSize = message.BufferSize();
+  DataRef ref;
+  ref.header = reinterpret_cast<char const*>(dh.data());
+  ref.payload = message.Buffer();
+
+  auto objStore = object_store_helpers::extractObjectFrom(ref);
+  BOOST_REQUIRE(std::holds_alternative<MergeInterfacePtr>(objStore));
+  auto read = dynamic_cast<SparseHistogramDelta*>(std::get<MergeInterfacePtr>(objStore).get());
+  BOOST_REQUIRE(read != nullptr);
+  BOOST_CHECK(read->isSparse());
+  BOOST_CHECK_EQUAL(read->getStoredBins(), 2);
+  checkSameHistograms(read->getHistogram(), &histogram);
+}
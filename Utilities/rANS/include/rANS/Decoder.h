@@ -22,6 +22,7 @@
 #include <iostream>
 #include <iomanip>
 #include <memory>
+#include <array>
 
 #include <fairlogger/Logger.h>
 
@@ -45,7 +46,8 @@ class Decoder : public internal::DecoderBase<coder_T, stream_T, source_T>
  public:
   using internal::DecoderBase<coder_T, stream_T, source_T>::DecoderBase;
 
-  template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool> = true>
+  // nStreams has to match the number of interleaved rANS states used by the encoder
+  template <size_t nStreams = 2, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool> = true>
   void process(stream_IT inputEnd, source_IT outputBegin, size_t messageLength) const;
 
  private:
@@ -53,7 +55,7 @@ class Decoder : public internal::DecoderBase<coder_T, stream_T, source_T>
 };
 
 template <typename coder_T, typename stream_T, typename source_T>
-template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool>>
+template <size_t nStreams, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool>>
 void Decoder<coder_T, stream_T, source_T>::process(stream_IT inputEnd, source_IT outputBegin, size_t messageLength) const
 {
   using namespace internal;
@@ -72,26 +74,29 @@ void Decoder<coder_T, stream_T, source_T>::process(stream_IT inputEnd, source_IT
   // make Iter point to the last last element
   --inputIter;
 
-  ransDecoder_t rans0{this->mSymbolTablePrecission};
-  ransDecoder_t rans1{this->mSymbolTablePrecission};
-
-  inputIter = rans0.init(inputIter);
-  inputIter = rans1.init(inputIter);
+  static_assert(nStreams > 0, "need at least one rANS stream");
+  std::array<ransDecoder_t, nStreams> decoders;
+  for (auto& decoder : decoders) {
+    decoder = ransDecoder_t{this->mSymbolTablePrecission};
+    inputIter = decoder.init(inputIter);
+  }
 
-  for (size_t i = 0; i < (messageLength & ~1); i += 2) {
-    const int64_t s0 = this->mReverseLUT[rans0.get()];
-    const int64_t s1 = this->mReverseLUT[rans1.get()];
-    *it++ = s0;
-    *it++ = s1;
-    inputIter = rans0.advanceSymbol(inputIter, this->mSymbolTable[s0]);
-    inputIter = rans1.advanceSymbol(inputIter, this->mSymbolTable[s1]);
+  auto decode = [&, this](ransDecoder_t& decoder) {
+    const int64_t symbol = this->mReverseLUT[decoder.get()];
+    *it++ = symbol;
+    inputIter = decoder.advanceSymbol(inputIter, this->mSymbolTable[symbol]);
+  };
+
+  const size_t nTail = messageLength % nStreams;
+  for (size_t i = 0; i < messageLength - nTail; i += nStreams) {
+    for (auto& decoder : decoders) {
+      decode(decoder);
+    }
   }
 
-  // last byte, if message length was odd
-  if (messageLength & 1) {
-    const int64_t s0 = this->mReverseLUT[rans0.get()];
-    *it = s0;
-    inputIter = rans0.advanceSymbol(inputIter, this->mSymbolTable[s0]);
+  // last symbols, if message length was not a multiple of nStreams
+  for (size_t i = 0; i < nTail; ++i) {
+    decode(decoders[i]);
   }
   t.stop();
   LOG(debug1) << "Decoder::" << __func__ << " { DecodedSymbols: " << messageLength << ","
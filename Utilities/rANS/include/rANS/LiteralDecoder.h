@@ -24,6 +24,7 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <array>
 
 #include <fairlogger/Logger.h>
 
@@ -44,7 +45,8 @@ class LiteralDecoder : public internal::DecoderBase<coder_T, stream_T, source_T>
  public:
   using internal::DecoderBase<coder_T, stream_T, source_T>::DecoderBase;
 
-  template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool> = true>
+  // nStreams has to match the number of interleaved rANS states used by the encoder
+  template <size_t nStreams = 2, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool> = true>
   void process(stream_IT inputEnd, source_IT outputBegin, size_t messageLength, std::vector<source_T>& literals) const;
 
  private:
@@ -52,7 +54,7 @@ class LiteralDecoder : public internal::DecoderBase<coder_T, stream_T, source_T>
 };
 
 template <typename coder_T, typename stream_T, typename source_T>
-template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool>>
+template <size_t nStreams, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<stream_T, stream_IT>, bool>>
 void LiteralDecoder<coder_T, stream_T, source_T>::process(stream_IT inputEnd, source_IT outputBegin, size_t messageLength, std::vector<source_T>& literals) const
 {
   using namespace internal;
@@ -83,19 +85,23 @@ void LiteralDecoder<coder_T, stream_T, source_T>::process(stream_IT inputEnd, so
   // make Iter point to the last last element
   --inputIter;
 
-  ransDecoder_t rans0{this->mSymbolTablePrecission};
-  ransDecoder_t rans1{this->mSymbolTablePrecission};
-  inputIter = rans0.init(inputIter);
-  inputIter = rans1.init(inputIter);
+  static_assert(nStreams > 0, "need at least one rANS stream");
+  std::array<ransDecoder_t, nStreams> decoders;
+  for (auto& decoder : decoders) {
+    decoder = ransDecoder_t{this->mSymbolTablePrecission};
+    inputIter = decoder.init(inputIter);
+  }
 
-  for (size_t i = 0; i < (messageLength & ~1); i += 2) {
-    std::tie(*it++, inputIter) = decode(rans0);
-    std::tie(*it++, inputIter) = decode(rans1);
+  const size_t nTail = messageLength % nStreams;
+  for (size_t i = 0; i < messageLength - nTail; i += nStreams) {
+    for (auto& decoder : decoders) {
+      std::tie(*it++, inputIter) = decode(decoder);
+    }
   }
 
-  // last byte, if message length was odd
-  if (messageLength & 1) {
-    std::tie(*it++, inputIter) = decode(rans0);
+  // last symbols, if message length was not a multiple of nStreams
+  for (size_t i = 0; i < nTail; ++i) {
+    std::tie(*it++, inputIter) = decode(decoders[i]);
   }
   t.stop();
   LOG(debug1) << "Decoder::" << __func__ << " { DecodedSymbols: " << messageLength << ","
@@ -18,6 +18,7 @@
 #define RANS_LITERAL_ENCODER_H
 
 #include <memory>
+#include <array>
 #include <algorithm>
 #include <iomanip>
 
@@ -42,7 +43,9 @@ class LiteralEncoder : public internal::EncoderBase<coder_T, stream_T, source_T>
   //inherit constructors;
   using internal::EncoderBase<coder_T, stream_T, source_T>::EncoderBase;
 
-  template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<source_T, source_IT>, bool> = true>
+  // nStreams independent rANS states are interleaved into the output stream. The default of 2 produces the legacy stream format,
+  // larger values shorten the serial dependency chain per state and must be matched by the decoder.
+  template <size_t nStreams = 2, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<source_T, source_IT>, bool> = true>
   stream_IT process(source_IT inputBegin, source_IT inputEnd, stream_IT outputBegin, std::vector<source_T>& literals) const;
 
  private:
@@ -50,7 +53,7 @@ class LiteralEncoder : public internal::EncoderBase<coder_T, stream_T, source_T>
 };
 
 template <typename coder_T, typename stream_T, typename source_T>
-template <typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<source_T, source_IT>, bool>>
+template <size_t nStreams, typename stream_IT, typename source_IT, std::enable_if_t<internal::isCompatibleIter_v<source_T, source_IT>, bool>>
 stream_IT LiteralEncoder<coder_T, stream_T, source_T>::process(source_IT inputBegin, source_IT inputEnd, stream_IT outputBegin, std::vector<source_T>& literals) const
 {
   using namespace internal;
@@ -63,8 +66,11 @@ stream_IT LiteralEncoder<coder_T, stream_T, source_T>::process(source_IT inputBe
     return outputBegin;
   }
 
-  ransCoder_t rans0{this->mSymbolTablePrecission};
-  ransCoder_t rans1{this->mSymbolTablePrecission};
+  static_assert(nStreams > 0, "need at least one rANS stream");
+  std::array<ransCoder_t, nStreams> coders;
+  for (auto& coder : coders) {
+    coder = ransCoder_t{this->mSymbolTablePrecission};
+  }
 
   stream_IT outputIter = outputBegin;
   source_IT inputIT = inputEnd;
@@ -80,17 +86,19 @@ stream_IT LiteralEncoder<coder_T, stream_T, source_T>::process(source_IT inputBe
     return coder.putSymbol(outputIter, encoderSymbol);
   };
 
-  // odd number of bytes?
-  if (inputBufferSize & 1) {
-    outputIter = encode(--inputIT, outputIter, rans0);
+  // symbol i is coded by state i % nStreams, the incomplete tail is handled first since we work in reverse
+  for (size_t i = inputBufferSize % nStreams; i-- > 0;) {
+    outputIter = encode(--inputIT, outputIter, coders[i]);
   }
 
   while (inputIT != inputBegin) { // NB: working in reverse!
-    outputIter = encode(--inputIT, outputIter, rans1);
-    outputIter = encode(--inputIT, outputIter, rans0);
+    for (size_t i = nStreams; i-- > 0;) {
+      outputIter = encode(--inputIT, outputIter, coders[i]);
+    }
+  }
+  for (size_t i = nStreams; i-- > 0;) {
+    outputIter = coders[i].flush(outputIter);
   }
-  outputIter = rans1.flush(outputIter);
-  outputIter = rans0.flush(outputIter);
   // first iterator past the range so that sizes, distances and iterators work correctly.
   ++outputIter;
 
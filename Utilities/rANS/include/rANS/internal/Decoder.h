@@ -46,6 +46,7 @@ class Decoder
                 "Coder can either be 32Bit with 8 Bit stream type or 64 Bit Type with 32 Bit stream type");
 
  public:
+  Decoder() noexcept = default;
   explicit Decoder(size_t symbolTablePrecission) noexcept;
 
   // Initializes a rANS decoder.
@@ -47,6 +47,7 @@ class Encoder
                 "Coder can either be 32Bit with 8 Bit stream type or 64 Bit Type with 32 Bit stream type");
 
  public:
+  Encoder() noexcept = default;
   explicit Encoder(size_t symbolTablePrecission) noexcept;
 
   template <typename stream_IT>
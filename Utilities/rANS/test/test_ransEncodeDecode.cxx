@@ -148,6 +148,33 @@ struct EncodeDecodeLiteral : public EncodeDecodeBase<o2::rans::LiteralEncoder, o
   std::vector<typename Params<coder_T>::source_t> literals;
 };
 
+template <typename coder_T, class dictString_T, class testString_T, size_t nStreams>
+struct EncodeDecodeInterleaved : public EncodeDecodeBase<o2::rans::Encoder, o2::rans::Decoder, coder_T, dictString_T, testString_T> {
+  void encode() override
+  {
+    BOOST_CHECK_NO_THROW(this->encoder.template process<nStreams>(std::begin(this->source.data), std::end(this->source.data), std::back_inserter(this->encodeBuffer)));
+  };
+  void decode() override
+  {
+    BOOST_CHECK_NO_THROW(this->decoder.template process<nStreams>(this->encodeBuffer.end(), std::back_inserter(this->decodeBuffer), this->source.data.size()));
+  };
+};
+
+template <typename coder_T, class dictString_T, class testString_T, size_t nStreams>
+struct EncodeDecodeLiteralInterleaved : public EncodeDecodeBase<o2::rans::LiteralEncoder, o2::rans::LiteralDecoder, coder_T, dictString_T, testString_T> {
+  void encode() override
+  {
+    BOOST_CHECK_NO_THROW(this->encoder.template process<nStreams>(std::begin(this->source.data), std::end(this->source.data), std::back_inserter(this->encodeBuffer), literals));
+  };
+  void decode() override
+  {
+    BOOST_CHECK_NO_THROW(this->decoder.template process<nStreams>(this->encodeBuffer.end(), std::back_inserter(this->decodeBuffer), this->source.data.size(), literals));
+    BOOST_CHECK(literals.empty());
+  };
+
+  std::vector<typename Params<coder_T>::source_t> literals;
+};
+
 template <typename coder_T, class dictString_T, class testString_T>
 struct EncodeDecodeDedup : public EncodeDecodeBase<o2::rans::DedupEncoder, o2::rans::DedupDecoder, coder_T, dictString_T, testString_T> {
   void encode() override
@@ -178,7 +205,13 @@ using testCase_t = boost::mpl::vector<EncodeDecode<uint32_t, EmptyTestString, Em
                                       EncodeDecodeDedup<uint32_t, EmptyTestString, EmptyTestString>,
                                       EncodeDecodeDedup<uint64_t, EmptyTestString, EmptyTestString>,
                                       EncodeDecodeDedup<uint32_t, FullTestString, FullTestString>,
-                                      EncodeDecodeDedup<uint64_t, FullTestString, FullTestString>>;
+                                      EncodeDecodeDedup<uint64_t, FullTestString, FullTestString>,
+                                      EncodeDecodeInterleaved<uint32_t, FullTestString, FullTestString, 1>,
+                                      EncodeDecodeInterleaved<uint64_t, FullTestString, FullTestString, 4>,
+                                      EncodeDecodeInterleaved<uint64_t, FullTestString, FullTestString, 8>,
+                                      EncodeDecodeInterleaved<uint64_t, FullTestString, FullTestString, 16>,
+                                      EncodeDecodeLiteralInterleaved<uint64_t, EmptyTestString, FullTestString, 8>,
+                                      EncodeDecodeLiteralInterleaved<uint64_t, FullTestString, FullTestString, 16>>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(test_encodeDecode, testCase_T, testCase_t)
 {
@@ -186,4 +219,27 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(test_encodeDecode, testCase_T, testCase_t)
   testCase.encode();
   testCase.decode();
   testCase.check();
+}
+
+BOOST_AUTO_TEST_CASE(test_interleavedDefaultStreamFormat)
+{
+  // the default interleaving must reproduce the legacy 2-state stream format
+  FullTestString source;
+  const std::string& s = source.data;
+  o2::rans::FrequencyTable frequencies;
+  frequencies.addSamples(std::begin(s), std::end(s));
+  o2::rans::Encoder64<char> encoder{frequencies, 16};
+  o2::rans::Decoder64<char> decoder{frequencies, 16};
+
+  std::vector<uint32_t> encodeBufferDefault;
+  std::vector<uint32_t> encodeBuffer2;
+  std::vector<uint32_t> encodeBuffer8;
+  encoder.process(std::begin(s), std::end(s), std::back_inserter(encodeBufferDefault));
+  encoder.process<2>(std::begin(s), std::end(s), std::back_inserter(encodeBuffer2));
+  encoder.process<8>(std::begin(s), std::end(s), std::back_inserter(encodeBuffer8));
+  BOOST_CHECK_EQUAL_COLLECTIONS(encodeBufferDefault.begin(), encodeBufferDefault.end(), encodeBuffer2.begin(), encodeBuffer2.end());
+
+  std::vector<char> decodeBuffer;
+  decoder.process<8>(encodeBuffer8.end(), std::back_inserter(decodeBuffer), s.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(s.begin(), s.end(), decodeBuffer.begin(), decodeBuffer.end());
 };
\ No newline at end of file